@@ -38,8 +38,22 @@ extern "C" {
  *  Util
  ********************************************************************************************
  */
+/* bytes of a 'width' x 'height' frame of 'fmt', 0 when unknown. Odd sizes of subsampled formats are
+ * sized like pixctrl_get_plane_layout(). */
 extern size_t pixctrl_get_image_size(pixctrl_fmt_t fmt, int32_t width, int32_t height);
+/* plane geometry of a linear frame, the one every converter accepting odd sizes reads and writes */
+extern pixctrl_result_t pixctrl_get_plane_layout(pixctrl_fmt_t fmt, int32_t width, int32_t height,
+                                                 pixctrl_plane_layout_t *layout);
 extern const char *pixctrl_get_format_as_ffmpeg_style_string(pixctrl_fmt_t fmt);
+extern pixctrl_result_t pixctrl_get_rgb_order(pixctrl_fmt_t fmt, pixctrl_rgb_order_t *order);
+extern pixctrl_result_t pixctrl_get_yuv_order(pixctrl_fmt_t fmt, pixctrl_yuv_order_t *order);
+/* horizontal and vertical chroma subsampling of 'fmt', offsets and sizes of a region must be multiples of these */
+extern pixctrl_result_t pixctrl_get_format_alignment(pixctrl_fmt_t fmt, int32_t *align_x, int32_t *align_y);
+extern pixctrl_result_t pixctrl_get_gray8_view(pixctrl_fmt_t fmt, uint8_t *src, int32_t width, int32_t height, uint8_t **gray);
+/* clips 'rect' to the 'width' x 'height' frame and grows it outwards to multiples of 'align_x' x 'align_y',
+ * an empty result is returned with a zero width and height */
+extern pixctrl_result_t pixctrl_get_aligned_rect(const pixctrl_rect_t *rect, int32_t align_x, int32_t align_y,
+                                                 int32_t width, int32_t height, pixctrl_rect_t *aligned);
 
 /********************************************************************************************
  *  RGB to RGB Converter
@@ -93,6 +107,9 @@ extern pixctrl_result_t pixctrl_generic_bgr24_to_rgb24(uint8_t *src, uint8_t *ds
  *  RGB to YUV Converter
  ********************************************************************************************
  */
+/* Odd 'width' and 'height' are accepted for subsampled destinations, laid out as pixctrl_get_plane_layout()
+ * describes. The padding sample of a packed 4:2:2 row replicates the last 'Y' sample.
+ */
 /* Interleaved to Interleaved Line-Stripe Function */
 extern void pixctrl_generic_xrgb_to_yuv444_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
                                                                   uint8_t *dst, const pixctrl_yuv_order_t *dst_order,
@@ -198,6 +215,48 @@ extern pixctrl_result_t pixctrl_generic_abgr_to_yuv420p(uint8_t *src, uint8_t *d
 extern pixctrl_result_t pixctrl_generic_rgba_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 extern pixctrl_result_t pixctrl_generic_bgra_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 
+/* Dirty Rectangle Converter, 'dst' holds the previous output and only the listed rectangles
+ * (grown to 2x2 chroma blocks) are converted into it.
+ *  rgb24, bgr24, 32-bit rgb -> nv12, nv21, yuv420p
+ */
+extern pixctrl_result_t pixctrl_generic_convert_dirty_rects(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                            pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                            const pixctrl_rect_t *rects, int32_t rect_count);
+
+/* Change Detection Converter, keeps a 64-bit fingerprint per 'tile_size' square of the previous source frame
+ * and reconverts into 'dst' (the previous output) only the tiles whose fingerprint changed, the first frame
+ * and the one after pixctrl_generic_change_detect_reset() are converted whole.
+ * 'changed' (may be NULL) receives the reconverted tiles, it must hold pixctrl_generic_change_detect_tiles() entries.
+ * The formats are the ones of pixctrl_generic_convert_dirty_rects(), a context is not shared between threads.
+ */
+extern pixctrl_result_t pixctrl_generic_change_detect_create(pixctrl_fmt_t src_fmt, int32_t width, int32_t height,
+                                                             pixctrl_fmt_t dst_fmt, int32_t tile_size,
+                                                             pixctrl_change_detect_t **detect);
+extern void pixctrl_generic_change_detect_destroy(pixctrl_change_detect_t *detect);
+extern void pixctrl_generic_change_detect_reset(pixctrl_change_detect_t *detect);
+extern int32_t pixctrl_generic_change_detect_tiles(const pixctrl_change_detect_t *detect);
+extern pixctrl_result_t pixctrl_generic_change_detect_convert(pixctrl_change_detect_t *detect, uint8_t *src, uint8_t *dst,
+                                                              pixctrl_rect_t *changed, int32_t *changed_count);
+
+/* Hash Line-Stripe Function, 64-bit fingerprint of 'len' bytes chained from 'seed' */
+extern uint64_t pixctrl_generic_hash_line_stripe(uint8_t *src, size_t len, uint64_t seed);
+
+/********************************************************************************************
+ *  RGB to GRAY Converter
+ ********************************************************************************************
+ */
+/* Interleaved to Gray Line-Stripe Function */
+extern void pixctrl_generic_xrgb_to_gray8_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
+                                                      uint8_t *dst, int32_t width);
+
+/* Interleaved rgb to gray8 */
+extern pixctrl_result_t pixctrl_generic_rgb24_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgr24_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_argb_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_abgr_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_rgba_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgra_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
 /********************************************************************************************
  *  YUV to YUV Converter
  ********************************************************************************************
@@ -223,6 +282,9 @@ extern void pixctrl_generic_yuv420_to_yuv444_line_stripe(uint8_t *y_src, uint8_t
 extern void pixctrl_generic_yuv420_to_yuv422_line_stripe(uint8_t *y_src, uint8_t *uv_src, const pixctrl_yuv_order_t *uv_src_order,
                                                          uint8_t *dst, const pixctrl_yuv_order_t *uv_dst_order,
                                                          int32_t width);
+extern void pixctrl_generic_yuv420_to_yuv420_line_stripe(uint8_t *y_src, uint8_t *uv_src, const pixctrl_yuv_order_t *uv_src_order,
+                                                         uint8_t *y_dst, uint8_t *uv_dst, const pixctrl_yuv_order_t *uv_dst_order,
+                                                         int32_t width, int32_t row);
 
 /* Interleaved to Planar Line-Stripe Function */
 extern void pixctrl_generic_yuv444_to_yuv444p_line_stripe(uint8_t *src, const pixctrl_yuv_order_t *src_order,
@@ -348,6 +410,10 @@ extern pixctrl_result_t pixctrl_generic_nv21_to_yvyu422(uint8_t *src, uint8_t *d
 extern pixctrl_result_t pixctrl_generic_nv21_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 extern pixctrl_result_t pixctrl_generic_nv21_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 
+/* Interleaved yuv420 to Interleaved yuv420 */
+extern pixctrl_result_t pixctrl_generic_nv12_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
 /* Interleaved yuv444 to Planar */
 extern pixctrl_result_t pixctrl_generic_yuv444_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 extern pixctrl_result_t pixctrl_generic_yuv444_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
@@ -414,15 +480,388 @@ extern pixctrl_result_t pixctrl_generic_yuv422p_to_yuv420p(uint8_t *src, uint8_t
 extern pixctrl_result_t pixctrl_generic_yuv420p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 extern pixctrl_result_t pixctrl_generic_yuv420p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
 
+/* Converter with 'Y' Plane Passthrough, both formats keep 'Y' in a plane of its own.
+ *  nv12, nv21, yuv444p, yuv422p, yuv420p -> nv12, nv21, yuv444p, yuv422p, yuv420p (formats must differ)
+ * PIXCTRL_Y_PLANE_ROW_COPY : 'dst' is a whole frame, each 'Y' row is copied next to its chroma row,
+ *                            what the plain converters above do.
+ * PIXCTRL_Y_PLANE_COPY     : 'dst' is a whole frame, its 'Y' plane is filled by one bulk copy up front;
+ *                            opt-in, it only pays off when 'Y' is large next to the chroma work.
+ * PIXCTRL_Y_PLANE_ALIAS    : 'dst' only receives the chroma plane(s), laid out as they would follow 'Y';
+ *                            the destination 'Y' plane is the one at 'src', nothing is copied.
+ * Any other pair returns PIXCTRL_NOT_SUPPORT, so this also tells whether 'Y' can be passed through.
+ */
+extern pixctrl_result_t pixctrl_generic_yuv_to_yuv_y_passthrough(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                                 pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                                 pixctrl_y_plane_mode_t y_mode);
+
+/********************************************************************************************
+ *  YUV to GRAY Converter
+ ********************************************************************************************
+ */
+/* Interleaved to Gray Line-Stripe Function */
+extern void pixctrl_generic_yuv444_to_gray8_line_stripe(uint8_t *src, const pixctrl_yuv_order_t *src_order,
+                                                        uint8_t *dst, int32_t width);
+extern void pixctrl_generic_yuv422_to_gray8_line_stripe(uint8_t *src, const pixctrl_yuv_order_t *src_order,
+                                                        uint8_t *dst, int32_t width);
+
+/* Interleaved yuv to gray8 */
+extern pixctrl_result_t pixctrl_generic_yuv444_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuyv422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yvyu422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_uyvy422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_vyuy422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Planar yuv to gray8 */
+extern pixctrl_result_t pixctrl_generic_yuv444p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv422p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
 /********************************************************************************************
  *  YUV to RGB Converter
  ********************************************************************************************
  */
 /* Interleaved to Interleaved Line-Stripe Function */
 /* Interleaved to Planar Line-Stripe Function */
+
+/* Semi-Planar to Interleaved Line-Stripe Function */
+extern void pixctrl_generic_yuv420_to_xrgb_line_stripe(uint8_t *y_src, uint8_t *uv_src, const pixctrl_yuv_order_t *uv_src_order,
+                                                       uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                       int32_t width);
+
 /* Planar to Interleaved Line-Stripe Function */
+extern void pixctrl_generic_yuv420p_to_xrgb_line_stripe(uint8_t *y_src, uint8_t *u_src, uint8_t *v_src,
+                                                        uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                        int32_t width);
 /* Planar to Planar Line-Stripe Function */
 
+/* Semi-Planar nv12 to Interleaved rgb */
+extern pixctrl_result_t pixctrl_generic_nv12_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Semi-Planar nv21 to Interleaved rgb */
+extern pixctrl_result_t pixctrl_generic_nv21_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv21_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Planar yuv420 to Interleaved rgb */
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_yuv420p_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/********************************************************************************************
+ *  Tiled YUV Converter
+ ********************************************************************************************
+ */
+/* Tiled to Linear Line-Stripe Function */
+extern void pixctrl_generic_detile_line_stripe(uint8_t *src, const pixctrl_tile_t *tile, int32_t row,
+                                               uint8_t *dst, int32_t width);
+
+/* Linear to Tiled Line-Stripe Function */
+extern void pixctrl_generic_tile_line_stripe(uint8_t *src, int32_t width,
+                                             uint8_t *dst, const pixctrl_tile_t *tile, int32_t row);
+
+/* Tiled nv12 16x16 to Linear yuv */
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Tiled nv12 16x16 to Interleaved rgb */
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_16x16_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Tiled nv12 64x32 to Linear yuv */
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Tiled nv12 64x32 to Interleaved rgb */
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_64x32_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Linear nv12 to Tiled nv12 */
+extern pixctrl_result_t pixctrl_generic_nv12_to_nv12_16x16(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_nv12_to_nv12_64x32(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/********************************************************************************************
+ *  Region of Interest Converter
+ ********************************************************************************************
+ */
+/* Converts 'src_rect' of the 'src_width' x 'src_height' source in place into the 'dst_width' x 'dst_height'
+ * destination at ('dst_x', 'dst_y'), the rest of 'dst' is left untouched and nothing is copied out first.
+ * Offsets, sizes and frame sizes must be multiples of pixctrl_get_format_alignment() of both formats.
+ * The pairs of the converters above are supported (no tiled formats), equal formats are cropped by copy.
+ */
+extern pixctrl_result_t pixctrl_generic_convert_roi(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                    const pixctrl_rect_t *src_rect,
+                                                    pixctrl_fmt_t dst_fmt, uint8_t *dst, int32_t dst_width, int32_t dst_height,
+                                                    int32_t dst_x, int32_t dst_y);
+
+/********************************************************************************************
+ *  RGB to RGB Mixer
+ ********************************************************************************************
+ */
+/* Alpha Line-Stripe Function ('src' and 'dst' may be the same buffer) */
+extern void pixctrl_generic_xrgb32_premultiply_line_stripe(uint8_t *src, uint8_t *dst,
+                                                           const pixctrl_rgb_order_t *order, int32_t width);
+extern void pixctrl_generic_xrgb32_unpremultiply_line_stripe(uint8_t *src, uint8_t *dst,
+                                                             const pixctrl_rgb_order_t *order, int32_t width);
+
+/* Straight to Premultiplied Alpha Function */
+extern pixctrl_result_t pixctrl_generic_rgba_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgra_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_argb_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_abgr_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_rgba_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgra_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_argb_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_abgr_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+
+/* Premultiplied to Straight Alpha Function */
+extern pixctrl_result_t pixctrl_generic_rgba_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgra_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_argb_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_abgr_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_rgba_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_bgra_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_argb_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+extern pixctrl_result_t pixctrl_generic_abgr_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height);
+
+/********************************************************************************************
+ *  RGB to YUV Mixer
+ ********************************************************************************************
+ */
+/* Interleaved to Semi-Planar/Planar Blend Line-Stripe Function */
+extern void pixctrl_generic_xrgb32_blend_to_y_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
+                                                          pixctrl_alpha_mode_t alpha_mode,
+                                                          uint8_t *y_dst, int32_t width);
+extern void pixctrl_generic_xrgb32_blend_to_uv_line_stripe(uint8_t *top, uint8_t *bottom, const pixctrl_rgb_order_t *src_order,
+                                                           pixctrl_alpha_mode_t alpha_mode, int32_t phase, int32_t width,
+                                                           uint8_t *u_dst, uint8_t *v_dst, int32_t uv_step);
+
+/* Odd 'width' and 'height' follow pixctrl_get_plane_layout(), the chroma sample of an odd last column
+ * or row is blended from the pixels it covers at full weight. */
+/* Interleaved rgb onto Semi-Planar nv12 */
+extern pixctrl_result_t pixctrl_generic_rgba_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_bgra_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_argb_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_abgr_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+
+/* Interleaved rgb onto Semi-Planar nv21 */
+extern pixctrl_result_t pixctrl_generic_rgba_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_bgra_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_argb_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_abgr_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                             pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                             int32_t x, int32_t y);
+
+/* Interleaved rgb onto Planar yuv420 */
+extern pixctrl_result_t pixctrl_generic_rgba_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                                int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_bgra_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                                int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_argb_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                                int32_t x, int32_t y);
+extern pixctrl_result_t pixctrl_generic_abgr_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                                int32_t x, int32_t y);
+
+/********************************************************************************************
+ *  Resize
+ ********************************************************************************************
+ */
+/* Tables are built once per geometry, a context is not shared between threads.
+ * Odd sizes of nv12, nv21, yuv422p and yuv420p use the chroma planes of pixctrl_get_plane_layout(). */
+extern pixctrl_result_t pixctrl_generic_resize_create(pixctrl_fmt_t fmt, pixctrl_resize_method_t method,
+                                                      int32_t src_width, int32_t src_height,
+                                                      int32_t dst_width, int32_t dst_height,
+                                                      pixctrl_resize_t **resize);
+extern void pixctrl_generic_resize_destroy(pixctrl_resize_t *resize);
+extern pixctrl_result_t pixctrl_generic_resize(pixctrl_resize_t *resize, uint8_t *src, uint8_t *dst);
+
+/* Fused Resize and Convert Function, scales in the source format of 'resize' one row at a time
+ * and converts each row straight into 'dst_fmt':
+ *  rgb24, bgr24, 32-bit rgb  -> nv12, nv21, yuv420p
+ *  nv12, nv21, yuv420p       -> rgb24, bgr24, 32-bit rgb
+ */
+extern pixctrl_result_t pixctrl_generic_resize_convert(pixctrl_resize_t *resize, uint8_t *src, pixctrl_fmt_t dst_fmt, uint8_t *dst);
+
+/* One-shot Resize Function */
+extern pixctrl_result_t pixctrl_generic_nearest_neighbor_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                uint8_t *dst, int32_t dst_width, int32_t dst_height);
+extern pixctrl_result_t pixctrl_generic_bilinear_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                        uint8_t *dst, int32_t dst_width, int32_t dst_height);
+extern pixctrl_result_t pixctrl_generic_bicubic_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                       uint8_t *dst, int32_t dst_width, int32_t dst_height);
+
+/********************************************************************************************
+ *  Rotate and Flip
+ ********************************************************************************************
+ */
+/* 'width' and 'height' describe 'src', a quarter turn swaps them for 'dst'. 'src' and 'dst' must not overlap.
+ * yuv422 formats only support PIXCTRL_ROTATE_0, PIXCTRL_ROTATE_180 and flips. Odd sizes use the chroma planes of
+ * pixctrl_get_plane_layout(), which turn and mirror as planes of their own. */
+extern pixctrl_result_t pixctrl_generic_rotate(pixctrl_fmt_t fmt, pixctrl_rotate_t rotate, uint8_t *src, int32_t width, int32_t height, uint8_t *dst);
+extern pixctrl_result_t pixctrl_generic_flip(pixctrl_fmt_t fmt, pixctrl_flip_t flip, uint8_t *src, int32_t width, int32_t height, uint8_t *dst);
+
+/* Fused Rotate and Convert Function, rotates a band of rows at a time and converts it straight into 'dst_fmt':
+ *  rgb24, bgr24, 32-bit rgb  -> nv12, nv21, yuv420p
+ * Odd sizes are written like the rgb to yuv converters write them.
+ */
+extern pixctrl_result_t pixctrl_generic_rotate_convert(pixctrl_fmt_t src_fmt, pixctrl_rotate_t rotate,
+                                                       uint8_t *src, int32_t width, int32_t height,
+                                                       pixctrl_fmt_t dst_fmt, uint8_t *dst);
+
+/********************************************************************************************
+ *  Raw and Demosaic
+ ********************************************************************************************
+ */
+/* Raw Unpack Line-Stripe Function */
+extern void pixctrl_generic_raw8_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width);
+extern void pixctrl_generic_raw16_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width, int32_t bits);
+extern void pixctrl_generic_raw10_mipi_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width);
+
+/* Raw Pack Line-Stripe Function */
+extern void pixctrl_generic_raw16_pack_line_stripe(uint16_t *src, uint8_t *dst, int32_t width);
+
+/* Packed MIPI raw10 to little-endian 16-bit raw10, 'width' must be a multiple of 4 */
+extern pixctrl_result_t pixctrl_generic_raw10_mipi_to_raw10(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+/* Demosaic Function, 'width' and 'height' must be even.
+ * The bayer rows are demosaiced one row at a time through a few cached rows and handed straight to:
+ *  rgb24, bgr24, 32-bit rgb (alpha 255), nv12, nv21, yuv420p, gray8
+ */
+extern pixctrl_result_t pixctrl_generic_demosaic(pixctrl_bayer_t pattern, pixctrl_raw_t raw, pixctrl_demosaic_method_t method,
+                                                 uint8_t *src, int32_t width, int32_t height,
+                                                 pixctrl_fmt_t dst_fmt, uint8_t *dst);
+
+/********************************************************************************************
+ *  ISP
+ ********************************************************************************************
+ */
+/* RGB48 Line-Stripe Function */
+extern void pixctrl_generic_rgb48_to_xrgb_line_stripe(uint16_t *src, int32_t bits,
+                                                      uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                      int32_t width);
+extern void pixctrl_generic_rgb48_isp_line_stripe(uint16_t *src, int32_t bits, const pixctrl_isp_t *isp,
+                                                  uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                  int32_t width);
+
+/* 'lut' receives (1 << bits) entries of 255 * (x / max) ^ (1 / gamma) */
+extern pixctrl_result_t pixctrl_generic_isp_gamma_lut(double gamma, int32_t bits, uint8_t *lut);
+
+/* Fused ISP Function, demosaic -> white balance -> colour correction -> gamma -> 'dst_fmt' on each row
+ * while it is still cached, with the same destinations as pixctrl_generic_demosaic(). */
+extern pixctrl_result_t pixctrl_generic_isp(const pixctrl_isp_t *isp,
+                                            pixctrl_bayer_t pattern, pixctrl_raw_t raw, pixctrl_demosaic_method_t method,
+                                            uint8_t *src, int32_t width, int32_t height,
+                                            pixctrl_fmt_t dst_fmt, uint8_t *dst);
+
+/********************************************************************************************
+ *  Luma Statistics
+ ********************************************************************************************
+ */
+/* clears 'stats' for a 'width' x 'height' frame split into a 'zones_x' x 'zones_y' grid */
+extern pixctrl_result_t pixctrl_luma_stats_init(pixctrl_luma_stats_t *stats, int32_t width, int32_t height,
+                                                int32_t zones_x, int32_t zones_y);
+
+/* adds 'src' to 'dst', both must share one geometry, e.g. per-thread tables of one frame */
+extern pixctrl_result_t pixctrl_luma_stats_merge(pixctrl_luma_stats_t *dst, const pixctrl_luma_stats_t *src);
+
+/* fills 'mean' and 'zone_mean' from the accumulated sums */
+extern pixctrl_result_t pixctrl_luma_stats_finish(pixctrl_luma_stats_t *stats);
+
+/* Luma Statistics Line-Stripe Function, accumulates the 'Y' row 'row' of the frame */
+extern void pixctrl_generic_luma_stats_line_stripe(uint8_t *src, int32_t row, pixctrl_luma_stats_t *stats);
+
+/* accumulates a whole 'Y' plane (or gray8 image) of the geometry of 'stats' */
+extern pixctrl_result_t pixctrl_generic_luma_stats(uint8_t *src, pixctrl_luma_stats_t *stats);
+
+/* Converter with Luma Statistics, 'width' and 'height' must match 'stats' (and be even for yuv sources).
+ * Each 'Y' row is accumulated right after it is written, so no extra pass over the frame is needed.
+ *  rgb24, bgr24, 32-bit rgb -> nv12, nv21, yuv420p
+ *  yuv444, yuyv422, yvyu422, uyvy422, vyuy422, yuv444p, yuv422p, yuv420p -> nv12, nv21
+ */
+extern pixctrl_result_t pixctrl_generic_convert_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                                pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                                pixctrl_luma_stats_t *stats);
+
+/********************************************************************************************
+ *  Instrumentation
+ ********************************************************************************************
+ */
+/* The format converters count calls, pixels, bytes and time per kernel in thread-local tables when the library
+ * is built with PIXCTRL_INSTRUMENT. Sums the counters of every thread, including the ones that have exited since
+ * the last call, into 'stats' and resets them; without PIXCTRL_INSTRUMENT 'stats' is left empty and
+ * PIXCTRL_NOT_SUPPORT is returned. */
+extern pixctrl_result_t pixctrl_stats_snapshot(pixctrl_stats_t *stats);
+/* 'begin' and 'end' run on the converting thread around every format converter, motion call and parallel band.
+ * NULL disables a callback, which then costs one branch per call. Set them before any conversion starts: a call
+ * or band already running keeps reporting to the callbacks and 'user' it began with, so its begin and end pair.
+ * Besides the format converters, the premultiply, blend and raw10 unpack calls are counted and traced; the calls
+ * taking a pixctrl_fmt_t (resize, rotate, flip, their fused converts, isp, roi, dirty rects, change detection,
+ * luma stats, 'Y' passthrough) are traced only. Convenience wrappers report the call doing the work, e.g. the
+ * per-method resizes as pixctrl_generic_resize and pixctrl_generic_demosaic as pixctrl_generic_isp, and change
+ * detection nests the dirty rect event inside its own. Setup calls (create, destroy, reset, init, merge, finish,
+ * gamma lut) are not traced. */
+extern void pixctrl_set_trace_callbacks(pixctrl_trace_fn_t begin, pixctrl_trace_fn_t end, void *user);
+
+/********************************************************************************************
+ *  Motion
+ ********************************************************************************************
+ */
+/* Motion Line-Stripe Function */
+extern void pixctrl_generic_absdiff_line_stripe(uint8_t *src0, uint8_t *src1, uint8_t *dst, int32_t width);
+/* adds the row to 'block_sad', one sum per PIXCTRL_MOTION_BLOCK columns (the last one may be narrower) */
+extern void pixctrl_generic_sad_line_stripe(uint8_t *src0, uint8_t *src1, uint32_t *block_sad, int32_t width);
+
+/* Motion Function, compares the gray8 images or the 'Y' planes of nv12, nv21, yuv420p, yuv422p, yuv444p frames.
+ * The rows are split into 'threads' bands (1 runs on the calling thread only).
+ *  absdiff     : 'dst' is a 'width' x 'height' gray8 image of |curr - prev|
+ *  block sad   : 'sad' holds one sum per PIXCTRL_MOTION_BLOCK square, ceil(width / 16) x ceil(height / 16), row-major
+ *  motion map  : 'map' holds 255 for each block whose sad exceeds 'threshold', 0 otherwise, laid out like 'sad'
+ */
+extern pixctrl_result_t pixctrl_generic_absdiff(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                                uint8_t *dst, int32_t threads);
+extern pixctrl_result_t pixctrl_generic_block_sad(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                                  uint32_t *sad, int32_t threads);
+extern pixctrl_result_t pixctrl_generic_motion_map(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                                   uint32_t threshold, uint8_t *map, int32_t threads);
+
 #ifdef  __cplusplus
 }
 #endif
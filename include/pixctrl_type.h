@@ -75,7 +75,7 @@ typedef struct {
                                       p  y  u  v  a */
 #define INIT_PIXCTRL_ORDER_YUV444   { 3, 0, 1, 2, 0, }
 #define INIT_PIXCTRL_ORDER_YUYV422  { 2, 0, 1, 3, 0, }
-#define INIT_PIXCTRL_ORDER_YVYU422  { 2, 2, 3, 1, 0, }
+#define INIT_PIXCTRL_ORDER_YVYU422  { 2, 0, 3, 1, 0, }
 #define INIT_PIXCTRL_ORDER_UYVY422  { 2, 1, 0, 2, 0, }
 #define INIT_PIXCTRL_ORDER_VYUY422  { 2, 1, 2, 0, 0, }
 #define INIT_PIXCTRL_ORDER_NV12     { 2, 0, 0, 1, 0, }
@@ -109,8 +109,172 @@ typedef enum {
     PIXCTRL_FMT_NV12,
     PIXCTRL_FMT_NV21,
     PIXCTRL_FMT_YUV420P,
+    /* GRAY */
+    PIXCTRL_FMT_GRAY8,
+    /* Tiled YUV420, see INIT_PIXCTRL_TILE_* */
+    PIXCTRL_FMT_NV12_16X16,
+    PIXCTRL_FMT_NV12_64X32,
 } pixctrl_fmt_t;
 
+/* 
+ - Tiled NV12 layout
+   The 'Y' plane and the interleaved 'UV' plane are each cut into tiles of 'width' bytes by 'height' rows.
+   Each tile is stored row by row, and the tiles are stored in raster order. Both planes are padded to whole
+   tiles, and the 'UV' plane starts right after the padded 'Y' plane.
+                                      w   h
+                                      i   e
+                                      d   i
+                                      t   g
+                                      h   h
+                                          t */
+#define INIT_PIXCTRL_TILE_16X16     { 16, 16, }
+#define INIT_PIXCTRL_TILE_64X32     { 64, 32, }
+
+typedef struct {
+    int32_t width;  /* bytes per tile row */
+    int32_t height; /* rows per tile */
+} pixctrl_tile_t;
+
+#define PIXCTRL_MAX_PLANES          (3)
+
+/* 
+ - Linear (not tiled) plane layout, see pixctrl_get_plane_layout()
+   Planes are stored back to back without padding. Subsampled chroma planes are ceil-sized, i.e.
+   (width + 1) / 2 samples per row and, for 4:2:0, (height + 1) / 2 rows, so an odd last column or row
+   keeps chroma of its own. Packed 4:2:2 rows are padded to a whole Y0-U-Y1-V macro-pixel. */
+typedef struct {
+    int32_t planes;
+    int32_t width[PIXCTRL_MAX_PLANES];      /* samples per row, an interleaved 'UV' pair is one sample */
+    int32_t height[PIXCTRL_MAX_PLANES];     /* rows */
+    int32_t stride[PIXCTRL_MAX_PLANES];     /* bytes per row */
+    size_t offset[PIXCTRL_MAX_PLANES];      /* from the start of the frame */
+    size_t size;                            /* bytes of the whole frame */
+} pixctrl_plane_layout_t;
+
+typedef enum {
+    PIXCTRL_Y_PLANE_COPY,           /* destination 'Y' plane is a bulk copy of the source one */
+    PIXCTRL_Y_PLANE_ALIAS,          /* destination shares the source 'Y' plane, only chroma is written */
+    PIXCTRL_Y_PLANE_ROW_COPY,       /* destination 'Y' rows are copied inside the conversion loop */
+} pixctrl_y_plane_mode_t;
+
+typedef enum {
+    PIXCTRL_ALPHA_STRAIGHT,         /* colour is not multiplied by alpha */
+    PIXCTRL_ALPHA_PREMULTIPLIED,    /* colour is already multiplied by alpha */
+} pixctrl_alpha_mode_t;
+
+typedef enum {
+    PIXCTRL_RESIZE_NEAREST_NEIGHBOR,
+    PIXCTRL_RESIZE_BILINEAR,
+    PIXCTRL_RESIZE_BICUBIC,
+} pixctrl_resize_method_t;
+
+typedef enum {
+    PIXCTRL_ROTATE_0,
+    PIXCTRL_ROTATE_90,              /* clockwise */
+    PIXCTRL_ROTATE_180,
+    PIXCTRL_ROTATE_270,             /* clockwise, i.e. 90 counter-clockwise */
+} pixctrl_rotate_t;
+
+typedef enum {
+    PIXCTRL_FLIP_HORIZONTAL,        /* mirror, left <-> right */
+    PIXCTRL_FLIP_VERTICAL,          /* top <-> bottom */
+} pixctrl_flip_t;
+
+typedef enum {
+    PIXCTRL_BAYER_RGGB,             /* colour of the top-left 2x2 cell, row by row */
+    PIXCTRL_BAYER_BGGR,
+    PIXCTRL_BAYER_GRBG,
+    PIXCTRL_BAYER_GBRG,
+} pixctrl_bayer_t;
+
+typedef enum {
+    PIXCTRL_RAW8,                   /* one byte per sample */
+    PIXCTRL_RAW10,                  /* little-endian 16-bit per sample, 10 significant bits */
+    PIXCTRL_RAW12,                  /* little-endian 16-bit per sample, 12 significant bits */
+    PIXCTRL_RAW10_MIPI,             /* MIPI CSI-2 packed, 4 samples in 5 bytes */
+} pixctrl_raw_t;
+
+typedef enum {
+    PIXCTRL_DEMOSAIC_BILINEAR,
+    PIXCTRL_DEMOSAIC_EDGE_AWARE,    /* green along the smoother gradient, red/blue by colour difference */
+} pixctrl_demosaic_method_t;
+
+#define PIXCTRL_ISP_Q               (10)    /* fractional bits of the isp gains and matrix */
+
+/* region of a frame in pixels */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+} pixctrl_rect_t;
+
+/* fixed-point stages applied to every demosaiced row, see pixctrl_generic_isp() */
+typedef struct {
+    int32_t wb_gain[3];             /* red, green, blue white balance gains, 1 << PIXCTRL_ISP_Q is unity */
+    int32_t ccm[9];                 /* row-major colour correction matrix, rows produce red, green, blue */
+    const uint8_t *gamma_lut;       /* (1 << raw bits) entries from linear to 8-bit, NULL for a linear shift */
+} pixctrl_isp_t;
+
+#define PIXCTRL_LUMA_STATS_BINS     (256)
+#define PIXCTRL_LUMA_STATS_MAX_ZONES (16)   /* per axis */
+
+/* 'Y' statistics of one frame, see pixctrl_luma_stats_init() and pixctrl_generic_convert_with_luma_stats() */
+typedef struct {
+    int32_t width, height;          /* frame the zone grid is laid over */
+    int32_t zones_x, zones_y;       /* zone grid, 1 to PIXCTRL_LUMA_STATS_MAX_ZONES on each axis */
+    uint32_t histogram[PIXCTRL_LUMA_STATS_BINS];
+    uint64_t count;                 /* accumulated samples */
+    uint64_t sum;
+    uint8_t min, max;
+    uint8_t mean;                   /* set by pixctrl_luma_stats_finish() */
+    uint64_t zone_sum[PIXCTRL_LUMA_STATS_MAX_ZONES * PIXCTRL_LUMA_STATS_MAX_ZONES];     /* row-major, zones_x per row */
+    uint8_t zone_mean[PIXCTRL_LUMA_STATS_MAX_ZONES * PIXCTRL_LUMA_STATS_MAX_ZONES];     /* set by pixctrl_luma_stats_finish() */
+} pixctrl_luma_stats_t;
+
+#define PIXCTRL_MOTION_BLOCK        (16)    /* block edge of the sad and motion map kernels */
+
+/* coefficient tables and row cache for one format/geometry/method, see pixctrl_generic_resize_create() */
+typedef struct pixctrl_resize pixctrl_resize_t;
+
+/* per-tile fingerprints of the previous source frame, see pixctrl_generic_change_detect_create() */
+typedef struct pixctrl_change_detect pixctrl_change_detect_t;
+
+#define PIXCTRL_STATS_MAX_KERNELS   (256)
+
+/* instrumentation of one converter, see pixctrl_stats_snapshot() */
+typedef struct {
+    const char *kernel;             /* converter name, e.g. "pixctrl_generic_nv12_to_yuv420p" */
+    uint64_t calls;
+    uint64_t pixels;
+    uint64_t bytes;                 /* source plus destination frame */
+    uint64_t nsec;                  /* cumulative wall time */
+} pixctrl_kernel_stats_t;
+
+typedef struct {
+    int32_t kernels;                /* used entries of 'kernel' */
+    pixctrl_kernel_stats_t kernel[PIXCTRL_STATS_MAX_KERNELS];
+} pixctrl_stats_t;
+
+typedef enum {
+    PIXCTRL_TRACE_KERNEL,           /* a top-level call */
+    PIXCTRL_TRACE_BAND,             /* one parallel band of a top-level call */
+} pixctrl_trace_scope_t;
+
+/* passed to the callbacks of pixctrl_set_trace_callbacks() */
+typedef struct {
+    pixctrl_trace_scope_t scope;
+    const char *kernel;             /* top-level function name, e.g. "pixctrl_generic_nv12_to_yuv420p" */
+    const char *backend;            /* e.g. "generic" */
+    int32_t width, height;          /* frame of the top-level call */
+    int32_t band;                   /* band index, -1 for PIXCTRL_TRACE_KERNEL */
+    int32_t begin, end;             /* units [begin, end) of the band, e.g. rows */
+    uint64_t thread;                /* id of the thread running it, the kernel thread id on linux */
+    pixctrl_result_t result;        /* PIXCTRL_SUCCESS on begin, the outcome on end */
+} pixctrl_trace_event_t;
+
+typedef void (*pixctrl_trace_fn_t)(const pixctrl_trace_event_t *event, void *user);
+
 #ifdef  __cplusplus
 }
 #endif
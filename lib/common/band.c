@@ -0,0 +1,122 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <pthread.h>
+#include "pixctrl.h"
+#include "common/band.h"
+#include "common/instrument.h"
+
+typedef struct {
+    pthread_t thread;
+    const char *kernel;
+    int32_t width;
+    int32_t height;
+    int32_t index;
+    pixctrl_band_fn_t fn;
+    void *arg;
+    int32_t begin;
+    int32_t end;
+    pixctrl_result_t result;
+} pixctrl_band_t;
+
+static void *pixctrl_band_entry(void *param)
+{
+    pixctrl_band_t *band = (pixctrl_band_t *)param;
+    const pixctrl_trace_hooks_t *hooks = PIXCTRL_TRACE_LOAD();
+
+    if (hooks->begin != NULL)
+    {
+        pixctrl_trace_fire(hooks, hooks->begin, PIXCTRL_TRACE_BAND, band->kernel, PIXCTRL_BACKEND_NAME,
+                           band->width, band->height, band->index, band->begin, band->end, PIXCTRL_SUCCESS);
+    }
+
+    band->result = band->fn(band->arg, band->begin, band->end);
+
+    if (hooks->end != NULL)
+    {
+        pixctrl_trace_fire(hooks, hooks->end, PIXCTRL_TRACE_BAND, band->kernel, PIXCTRL_BACKEND_NAME,
+                           band->width, band->height, band->index, band->begin, band->end, band->result);
+    }
+
+    return NULL;
+}
+
+pixctrl_result_t pixctrl_run_bands(const char *kernel, int32_t width, int32_t height,
+                                   pixctrl_band_fn_t fn, void *arg, int32_t units, int32_t threads)
+{
+    pixctrl_band_t bands[PIXCTRL_MAX_THREADS];
+    int32_t started[PIXCTRL_MAX_THREADS];
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    register int32_t i, count;
+
+    count = (threads < 1) ? 1 : ((threads > PIXCTRL_MAX_THREADS) ? PIXCTRL_MAX_THREADS : threads);
+    count = (count > units) ? units : count;
+
+    for (i = 0; i < count; ++i)
+    {
+        bands[i].kernel = kernel;
+        bands[i].width = width;
+        bands[i].height = height;
+        bands[i].index = i;
+        bands[i].fn = fn;
+        bands[i].arg = arg;
+        bands[i].begin = (int32_t)(((int64_t)units * i) / count);
+        bands[i].end = (int32_t)(((int64_t)units * (i + 1)) / count);
+        bands[i].result = PIXCTRL_SUCCESS;
+        started[i] = 0;
+    }
+
+    /* a band whose thread could not be started runs on the calling thread instead */
+    for (i = 0; i < (count - 1); ++i)
+    {
+        if (pthread_create(&bands[i].thread, NULL, pixctrl_band_entry, &bands[i]) == 0)
+        {
+            started[i] = 1;
+        }
+        else
+        {
+            (void)pixctrl_band_entry(&bands[i]);
+        }
+    }
+    if (count > 0)
+    {
+        (void)pixctrl_band_entry(&bands[count - 1]);
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        if (started[i] != 0)
+        {
+            (void)pthread_join(bands[i].thread, NULL);
+        }
+        if ((result == PIXCTRL_SUCCESS) && (bands[i].result != PIXCTRL_SUCCESS))
+        {
+            result = bands[i].result;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,40 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef BAND_H
+#define BAND_H
+
+#define PIXCTRL_MAX_THREADS     (16)
+
+/* processes units [begin, end) of a job, e.g. rows or block rows */
+typedef pixctrl_result_t (*pixctrl_band_fn_t)(void *arg, int32_t begin, int32_t end);
+
+/* splits 'units' into up to 'threads' contiguous bands, runs the last one on the calling thread
+ * and returns the first failure of any band. 'kernel', 'width' and 'height' name the top-level call
+ * for the trace callbacks. */
+extern pixctrl_result_t pixctrl_run_bands(const char *kernel, int32_t width, int32_t height,
+                                          pixctrl_band_fn_t fn, void *arg, int32_t units, int32_t threads);
+
+#endif  /* !BAND_H */
@@ -0,0 +1,372 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#include "pixctrl.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Trace
+ ********************************************************************************************
+ */
+static const pixctrl_trace_hooks_t gsc_trace_none = { NULL, NULL, NULL, NULL, };
+
+/* replaced as a whole by pixctrl_set_trace_callbacks(), a conversion may still hold a previous registration, so
+ * none is ever freed; gs_trace_lock guards the list of them in gs_trace_registered */
+const pixctrl_trace_hooks_t *pixctrl_trace_hooks = &gsc_trace_none;
+static pthread_mutex_t gs_trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static const pixctrl_trace_hooks_t *gs_trace_registered = NULL;
+
+/* the kernel thread id never changes, so it is asked for once per thread; a forked child asks again */
+static __thread uint64_t gs_trace_thread = 0U;
+static pthread_once_t gs_trace_once = PTHREAD_ONCE_INIT;
+
+static void pixctrl_trace_forget_thread(void)
+{
+    gs_trace_thread = 0U;
+}
+
+static void pixctrl_trace_init_fork(void)
+{
+    (void)pthread_atfork(NULL, NULL, pixctrl_trace_forget_thread);
+}
+
+void pixctrl_set_trace_callbacks(pixctrl_trace_fn_t begin, pixctrl_trace_fn_t end, void *user)
+{
+    pixctrl_trace_hooks_t *hooks = NULL;
+
+    (void)pthread_once(&gs_trace_once, pixctrl_trace_init_fork);
+    if ((begin == NULL) && (end == NULL))
+    {
+        __atomic_store_n(&pixctrl_trace_hooks, &gsc_trace_none, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        /* the previous callbacks stay set when this fails */
+        hooks = (pixctrl_trace_hooks_t *)malloc(sizeof(pixctrl_trace_hooks_t));
+        if (hooks != NULL)
+        {
+            hooks->begin = begin;
+            hooks->end = end;
+            hooks->user = user;
+            (void)pthread_mutex_lock(&gs_trace_lock);
+            hooks->next = gs_trace_registered;
+            gs_trace_registered = hooks;
+            __atomic_store_n(&pixctrl_trace_hooks, hooks, __ATOMIC_RELEASE);
+            (void)pthread_mutex_unlock(&gs_trace_lock);
+        }
+    }
+}
+
+void pixctrl_trace_fire(const pixctrl_trace_hooks_t *hooks, pixctrl_trace_fn_t fn, pixctrl_trace_scope_t scope,
+                        const char *kernel, const char *backend, int32_t width, int32_t height,
+                        int32_t band, int32_t begin, int32_t end, pixctrl_result_t result)
+{
+    pixctrl_trace_event_t event;
+
+    event.scope = scope;
+    event.kernel = kernel;
+    event.backend = backend;
+    event.width = width;
+    event.height = height;
+    event.band = band;
+    event.begin = begin;
+    event.end = end;
+#ifdef __linux__
+    if (gs_trace_thread == 0U)
+    {
+        gs_trace_thread = (uint64_t)syscall(SYS_gettid);
+    }
+#endif
+    event.thread = gs_trace_thread;
+    event.result = result;
+
+    fn(&event, hooks->user);
+}
+
+/********************************************************************************************
+ *  Counters
+ ********************************************************************************************
+ */
+
+#ifdef PIXCTRL_INSTRUMENT
+
+/* One table per thread, open addressing on the address of the kernel name. Only the owner thread writes 'kernel'
+ * and 'seq', a slot once taken keeps its kernel for the life of the thread. 'seq' is odd while an entry is being
+ * updated, so a snapshot copies the table without a lock and retries when 'seq' moved underneath it. */
+typedef struct pixctrl_stats_table {
+    uint32_t seq;
+    pixctrl_kernel_stats_t kernel[PIXCTRL_STATS_MAX_KERNELS];
+    pixctrl_kernel_stats_t taken[PIXCTRL_STATS_MAX_KERNELS];  /* already reported, under gs_stats_lock */
+    struct pixctrl_stats_table *next;
+} pixctrl_stats_table_t;
+
+/* gs_stats_lock guards the list of live tables, their 'taken' counters and the counters of the threads that
+ * have exited, the owner threads never take it after registration */
+static pthread_mutex_t gs_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t gs_stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t gs_stats_key;
+static pixctrl_stats_table_t *gs_stats_tables = NULL;
+static pixctrl_kernel_stats_t gs_stats_retired[PIXCTRL_STATS_MAX_KERNELS];
+static pixctrl_kernel_stats_t gs_stats_sum[PIXCTRL_STATS_MAX_KERNELS];
+static pixctrl_kernel_stats_t gs_stats_copy[PIXCTRL_STATS_MAX_KERNELS];
+static __thread pixctrl_stats_table_t *gs_stats_table = NULL;
+
+static uint64_t pixctrl_instrument_now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/* the entry of 'kernel' in 'table' or the free slot it goes to, NULL when the table is full */
+static pixctrl_kernel_stats_t *pixctrl_stats_find(pixctrl_kernel_stats_t *table, const char *kernel)
+{
+    register uint32_t slot = (uint32_t)(((uintptr_t)kernel * 2654435761U) >> 8) % PIXCTRL_STATS_MAX_KERNELS;
+    register uint32_t probe;
+    pixctrl_kernel_stats_t *entry = NULL;
+
+    for (probe = 0; probe < PIXCTRL_STATS_MAX_KERNELS; ++probe)
+    {
+        entry = &table[(slot + probe) % PIXCTRL_STATS_MAX_KERNELS];
+        if ((entry->kernel == kernel) || (entry->kernel == NULL))
+        {
+            break;
+        }
+        entry = NULL;
+    }
+
+    return entry;
+}
+
+/* adds 'add' to the entry of its kernel in 'table', a full table drops it */
+static void pixctrl_stats_add(pixctrl_kernel_stats_t *table, const pixctrl_kernel_stats_t *add)
+{
+    pixctrl_kernel_stats_t *entry = pixctrl_stats_find(table, add->kernel);
+
+    if (entry != NULL)
+    {
+        entry->kernel = add->kernel;
+        entry->calls += add->calls;
+        entry->pixels += add->pixels;
+        entry->bytes += add->bytes;
+        entry->nsec += add->nsec;
+    }
+}
+
+/* the owner thread's update: plain loads of its own counters, relaxed stores bracketed by 'seq' */
+static void pixctrl_stats_count(pixctrl_stats_table_t *table, const pixctrl_kernel_stats_t *add)
+{
+    pixctrl_kernel_stats_t *entry = pixctrl_stats_find(table->kernel, add->kernel);
+    register uint32_t seq = table->seq;
+
+    if (entry != NULL)
+    {
+        __atomic_store_n(&table->seq, seq + 1U, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&entry->kernel, add->kernel, __ATOMIC_RELAXED);
+        __atomic_store_n(&entry->calls, entry->calls + add->calls, __ATOMIC_RELAXED);
+        __atomic_store_n(&entry->pixels, entry->pixels + add->pixels, __ATOMIC_RELAXED);
+        __atomic_store_n(&entry->bytes, entry->bytes + add->bytes, __ATOMIC_RELAXED);
+        __atomic_store_n(&entry->nsec, entry->nsec + add->nsec, __ATOMIC_RELAXED);
+        __atomic_store_n(&table->seq, seq + 2U, __ATOMIC_RELEASE);
+    }
+}
+
+/* copies the counters of 'table' into 'copy' while its owner may still be counting */
+static void pixctrl_stats_read(const pixctrl_stats_table_t *table, pixctrl_kernel_stats_t *copy)
+{
+    uint32_t begin;
+    uint32_t end;
+    int32_t i;
+
+    do
+    {
+        begin = __atomic_load_n(&table->seq, __ATOMIC_ACQUIRE);
+        for (i = 0; i < PIXCTRL_STATS_MAX_KERNELS; ++i)
+        {
+            copy[i].kernel = __atomic_load_n(&table->kernel[i].kernel, __ATOMIC_RELAXED);
+            copy[i].calls = __atomic_load_n(&table->kernel[i].calls, __ATOMIC_RELAXED);
+            copy[i].pixels = __atomic_load_n(&table->kernel[i].pixels, __ATOMIC_RELAXED);
+            copy[i].bytes = __atomic_load_n(&table->kernel[i].bytes, __ATOMIC_RELAXED);
+            copy[i].nsec = __atomic_load_n(&table->kernel[i].nsec, __ATOMIC_RELAXED);
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&table->seq, __ATOMIC_RELAXED);
+    } while (((begin & 1U) != 0U) || (begin != end));
+}
+
+/* adds what 'table' counted since its last take to 'dst', under gs_stats_lock */
+static void pixctrl_stats_take(pixctrl_kernel_stats_t *dst, pixctrl_stats_table_t *table)
+{
+    pixctrl_kernel_stats_t add;
+    int32_t i;
+
+    pixctrl_stats_read(table, gs_stats_copy);
+    for (i = 0; i < PIXCTRL_STATS_MAX_KERNELS; ++i)
+    {
+        if (gs_stats_copy[i].calls != table->taken[i].calls)
+        {
+            add.kernel = gs_stats_copy[i].kernel;
+            add.calls = gs_stats_copy[i].calls - table->taken[i].calls;
+            add.pixels = gs_stats_copy[i].pixels - table->taken[i].pixels;
+            add.bytes = gs_stats_copy[i].bytes - table->taken[i].bytes;
+            add.nsec = gs_stats_copy[i].nsec - table->taken[i].nsec;
+            pixctrl_stats_add(dst, &add);
+            table->taken[i] = gs_stats_copy[i];
+        }
+    }
+}
+
+/* runs as a thread exits, its counters move to gs_stats_retired so the next snapshot still sees them */
+static void pixctrl_stats_retire(void *arg)
+{
+    pixctrl_stats_table_t *table = (pixctrl_stats_table_t *)arg;
+    pixctrl_stats_table_t **link;
+
+    (void)pthread_mutex_lock(&gs_stats_lock);
+    for (link = &gs_stats_tables; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == table)
+        {
+            *link = table->next;
+            break;
+        }
+    }
+    pixctrl_stats_take(gs_stats_retired, table);
+    (void)pthread_mutex_unlock(&gs_stats_lock);
+
+    free(table);
+}
+
+static void pixctrl_stats_init_key(void)
+{
+    (void)pthread_key_create(&gs_stats_key, pixctrl_stats_retire);
+}
+
+/* the calling thread's table, registered on first use, NULL when it cannot be allocated */
+static pixctrl_stats_table_t *pixctrl_stats_get_table(void)
+{
+    pixctrl_stats_table_t *table = gs_stats_table;
+
+    if (table == NULL)
+    {
+        (void)pthread_once(&gs_stats_once, pixctrl_stats_init_key);
+        table = (pixctrl_stats_table_t *)calloc(1, sizeof(pixctrl_stats_table_t));
+        if (table != NULL)
+        {
+            (void)pthread_mutex_lock(&gs_stats_lock);
+            table->next = gs_stats_tables;
+            gs_stats_tables = table;
+            (void)pthread_mutex_unlock(&gs_stats_lock);
+            (void)pthread_setspecific(gs_stats_key, table);
+            gs_stats_table = table;
+        }
+    }
+
+    return table;
+}
+
+void pixctrl_instrument_begin(pixctrl_instrument_mark_t *mark)
+{
+    mark->nsec = pixctrl_instrument_now();
+}
+
+void pixctrl_instrument_end(const pixctrl_instrument_mark_t *mark, const char *kernel,
+                            int32_t width, int32_t height, uint32_t src_bits, uint32_t dst_bits)
+{
+    pixctrl_stats_table_t *table = pixctrl_stats_get_table();
+    pixctrl_kernel_stats_t add;
+
+    add.kernel = kernel;
+    add.calls = 1U;
+    add.pixels = (uint64_t)width * (uint64_t)height;
+    add.bytes = (add.pixels * ((uint64_t)src_bits + (uint64_t)dst_bits)) / 8U;
+    add.nsec = pixctrl_instrument_now() - mark->nsec;
+
+    if (table != NULL)
+    {
+        pixctrl_stats_count(table, &add);
+    }
+}
+
+pixctrl_result_t pixctrl_stats_snapshot(pixctrl_stats_t *stats)
+{
+    pixctrl_result_t result = PIXCTRL_MUST_NOT_BE_NULL;
+    pixctrl_stats_table_t *table;
+    int32_t i;
+
+    if (stats != NULL)
+    {
+        (void)pthread_mutex_lock(&gs_stats_lock);
+        (void)memcpy(gs_stats_sum, gs_stats_retired, sizeof(gs_stats_sum));
+        (void)memset(gs_stats_retired, 0, sizeof(gs_stats_retired));
+        for (table = gs_stats_tables; table != NULL; table = table->next)
+        {
+            pixctrl_stats_take(gs_stats_sum, table);
+        }
+
+        stats->kernels = 0;
+        for (i = 0; i < PIXCTRL_STATS_MAX_KERNELS; ++i)
+        {
+            if (gs_stats_sum[i].kernel != NULL)
+            {
+                stats->kernel[stats->kernels] = gs_stats_sum[i];
+                stats->kernels += 1;
+            }
+        }
+        (void)pthread_mutex_unlock(&gs_stats_lock);
+        result = PIXCTRL_SUCCESS;
+    }
+
+    return result;
+}
+
+#else
+
+pixctrl_result_t pixctrl_stats_snapshot(pixctrl_stats_t *stats)
+{
+    pixctrl_result_t result = PIXCTRL_MUST_NOT_BE_NULL;
+
+    if (stats != NULL)
+    {
+        stats->kernels = 0;
+        result = PIXCTRL_NOT_SUPPORT;
+    }
+
+    return result;
+}
+
+#endif  /* PIXCTRL_INSTRUMENT */
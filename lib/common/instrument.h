@@ -0,0 +1,101 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#ifndef PIXCTRL_BACKEND_NAME
+#define PIXCTRL_BACKEND_NAME        "generic"
+#endif
+
+typedef struct pixctrl_trace_hooks {
+    pixctrl_trace_fn_t begin;
+    pixctrl_trace_fn_t end;
+    void *user;
+    const struct pixctrl_trace_hooks *next;    /* the registration made before this one */
+} pixctrl_trace_hooks_t;
+
+/* never NULL, points to a registration that is not modified once published */
+extern const pixctrl_trace_hooks_t *pixctrl_trace_hooks;
+
+/* builds the event and calls 'fn' with the 'user' of 'hooks', only reached while a callback is registered */
+extern void pixctrl_trace_fire(const pixctrl_trace_hooks_t *hooks, pixctrl_trace_fn_t fn, pixctrl_trace_scope_t scope,
+                               const char *kernel, const char *backend, int32_t width, int32_t height,
+                               int32_t band, int32_t begin, int32_t end, pixctrl_result_t result);
+
+#define PIXCTRL_TRACE_LOAD()    __atomic_load_n(&pixctrl_trace_hooks, __ATOMIC_ACQUIRE)
+
+/* a span loads the hooks once, so its end pairs with its begin even when the callbacks are set meanwhile */
+#define PIXCTRL_TRACE_BEGIN(width, height)                                                              \
+    const pixctrl_trace_hooks_t *trace_hooks = PIXCTRL_TRACE_LOAD();                                    \
+    do {                                                                                                \
+        if (trace_hooks->begin != NULL)                                                                 \
+        {                                                                                               \
+            pixctrl_trace_fire(trace_hooks, trace_hooks->begin, PIXCTRL_TRACE_KERNEL, __func__,         \
+                               PIXCTRL_BACKEND_NAME, (width), (height), -1, 0, 0, PIXCTRL_SUCCESS);     \
+        }                                                                                               \
+    } while (0)
+#define PIXCTRL_TRACE_END(width, height, result)                                                        \
+    do {                                                                                                \
+        if (trace_hooks->end != NULL)                                                                   \
+        {                                                                                               \
+            pixctrl_trace_fire(trace_hooks, trace_hooks->end, PIXCTRL_TRACE_KERNEL, __func__,           \
+                               PIXCTRL_BACKEND_NAME, (width), (height), -1, 0, 0, (result));            \
+        }                                                                                               \
+    } while (0)
+
+#ifdef PIXCTRL_INSTRUMENT
+
+typedef struct {
+    uint64_t nsec;
+} pixctrl_instrument_mark_t;
+
+extern void pixctrl_instrument_begin(pixctrl_instrument_mark_t *mark);
+/* adds one call of 'kernel' to the calling thread's table, 'src_bits' and 'dst_bits' are bits per pixel */
+extern void pixctrl_instrument_end(const pixctrl_instrument_mark_t *mark, const char *kernel,
+                                   int32_t width, int32_t height, uint32_t src_bits, uint32_t dst_bits);
+
+#define PIXCTRL_INSTRUMENT_MARK()                                       \
+    pixctrl_instrument_mark_t instrument_mark;                          \
+    pixctrl_instrument_begin(&instrument_mark)
+#define PIXCTRL_INSTRUMENT_COUNT(width, height, src_bits, dst_bits)     \
+    pixctrl_instrument_end(&instrument_mark, __func__, (width), (height), (src_bits), (dst_bits))
+
+#else
+
+#define PIXCTRL_INSTRUMENT_MARK()
+#define PIXCTRL_INSTRUMENT_COUNT(width, height, src_bits, dst_bits)
+
+#endif  /* PIXCTRL_INSTRUMENT */
+
+/* wrap a top-level converter, the trace callbacks see the counting as part of the call */
+#define PIXCTRL_KERNEL_BEGIN(width, height)                             \
+    PIXCTRL_TRACE_BEGIN(width, height);                                 \
+    PIXCTRL_INSTRUMENT_MARK()
+#define PIXCTRL_KERNEL_END(result, width, height, src_bits, dst_bits)   \
+    PIXCTRL_INSTRUMENT_COUNT(width, height, src_bits, dst_bits);        \
+    PIXCTRL_TRACE_END(width, height, result)
+
+#endif  /* !INSTRUMENT_H */
@@ -25,30 +25,136 @@
  */
 #include "pixctrl.h"
 
+/* a tiled nv12 frame holds its 'Y' and 'UV' planes padded to whole tiles */
+static size_t pixctrl_get_tiled_nv12_size(const pixctrl_tile_t tile, int32_t width, int32_t height)
+{
+    const size_t tiled_width = (size_t)(((width + tile.width) - 1) / tile.width) * (size_t)tile.width;
+    const size_t y_rows = (size_t)(((height + tile.height) - 1) / tile.height) * (size_t)tile.height;
+    const size_t uv_rows = (size_t)((((height / 2) + tile.height) - 1) / tile.height) * (size_t)tile.height;
+
+    return tiled_width * (y_rows + uv_rows);
+}
+
+pixctrl_result_t pixctrl_get_plane_layout(pixctrl_fmt_t fmt, int32_t width, int32_t height,
+                                          pixctrl_plane_layout_t *layout)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    const int32_t chroma_width = (width + 1) / 2;       /* an odd last column keeps a chroma sample */
+    const int32_t chroma_height = (height + 1) / 2;     /* an odd last row keeps a chroma row */
+    int32_t i;
+
+    if (layout != NULL)
+    {
+        if ((0 < width) && (0 < height))
+        {
+            layout->planes = 1;
+            for (i = 0; i < PIXCTRL_MAX_PLANES; ++i)
+            {
+                layout->width[i] = width;
+                layout->height[i] = height;
+                layout->stride[i] = width;
+            }
+
+            switch (fmt)
+            {
+            case PIXCTRL_FMT_RGBA32:
+            case PIXCTRL_FMT_BGRA32:
+            case PIXCTRL_FMT_ARGB32:
+            case PIXCTRL_FMT_ABGR32:
+            case PIXCTRL_FMT_RGBX32:
+            case PIXCTRL_FMT_BGRX32:
+            case PIXCTRL_FMT_XRGB32:
+            case PIXCTRL_FMT_XBGR32:
+                layout->stride[0] = width * 4;
+                break;
+            case PIXCTRL_FMT_BGR24:
+            case PIXCTRL_FMT_RGB24:
+            case PIXCTRL_FMT_YUV444:
+                layout->stride[0] = width * 3;
+                break;
+            case PIXCTRL_FMT_GRAY8:
+                break;
+            case PIXCTRL_FMT_YUV444P:
+                layout->planes = 3;
+                break;
+            case PIXCTRL_FMT_YUYV422:
+            case PIXCTRL_FMT_YVYU422:
+            case PIXCTRL_FMT_UYVY422:
+            case PIXCTRL_FMT_VYUY422:
+                layout->stride[0] = chroma_width * 4;
+                break;
+            case PIXCTRL_FMT_YUV422P:
+                layout->planes = 3;
+                for (i = 1; i < 3; ++i)
+                {
+                    layout->width[i] = chroma_width;
+                    layout->stride[i] = chroma_width;
+                }
+                break;
+            case PIXCTRL_FMT_NV12:
+            case PIXCTRL_FMT_NV21:
+                layout->planes = 2;
+                layout->width[1] = chroma_width;
+                layout->height[1] = chroma_height;
+                layout->stride[1] = chroma_width * 2;
+                break;
+            case PIXCTRL_FMT_YUV420P:
+                layout->planes = 3;
+                for (i = 1; i < 3; ++i)
+                {
+                    layout->width[i] = chroma_width;
+                    layout->height[i] = chroma_height;
+                    layout->stride[i] = chroma_width;
+                }
+                break;
+            default:
+                /* tiled layouts pad their planes, see pixctrl_get_image_size() */
+                layout->planes = 0;
+                result = PIXCTRL_NOT_SUPPORT;
+                break;
+            }
+
+            layout->size = 0U;
+            for (i = 0; i < PIXCTRL_MAX_PLANES; ++i)
+            {
+                if (i >= layout->planes)
+                {
+                    layout->width[i] = 0;
+                    layout->height[i] = 0;
+                    layout->stride[i] = 0;
+                }
+                layout->offset[i] = layout->size;
+                layout->size += (size_t)layout->stride[i] * (size_t)layout->height[i];
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
 size_t pixctrl_get_image_size(pixctrl_fmt_t fmt, int32_t width, int32_t height)
 {
-    const size_t bpp32 = 4U;
-    const size_t bpp24 = 3U;
+    pixctrl_plane_layout_t layout;
     size_t len = 0;
 
     switch (fmt)
     {
-    case PIXCTRL_FMT_RGBA32:
-    case PIXCTRL_FMT_BGRA32:
-    case PIXCTRL_FMT_ARGB32:
-    case PIXCTRL_FMT_ABGR32:
-    case PIXCTRL_FMT_RGBX32:
-    case PIXCTRL_FMT_BGRX32:
-    case PIXCTRL_FMT_XRGB32:
-    case PIXCTRL_FMT_XBGR32:
-        len = ((size_t)width * bpp32) * (size_t)height; 
+    case PIXCTRL_FMT_NV12_16X16:
+        len = pixctrl_get_tiled_nv12_size((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16, width, height);
         break;
-    case PIXCTRL_FMT_BGR24:
-    case PIXCTRL_FMT_RGB24:
-        len = ((size_t)width * bpp24) * (size_t)height; 
+    case PIXCTRL_FMT_NV12_64X32:
+        len = pixctrl_get_tiled_nv12_size((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32, width, height);
         break;
     default:
-        len = 0U;
+        len = (pixctrl_get_plane_layout(fmt, width, height, &layout) == PIXCTRL_SUCCESS) ? layout.size : 0U;
         break;
     }
 
@@ -90,6 +196,9 @@ const char *pixctrl_get_format_as_ffmpeg_style_string(pixctrl_fmt_t fmt)
     case PIXCTRL_FMT_RGB24:
         string_as_ffmpeg_style = "rgb24";
         break;
+    case PIXCTRL_FMT_GRAY8:
+        string_as_ffmpeg_style = "gray";
+        break;
     default:
         string_as_ffmpeg_style = "unknown";
         break;
@@ -97,3 +206,221 @@ const char *pixctrl_get_format_as_ffmpeg_style_string(pixctrl_fmt_t fmt)
 
     return string_as_ffmpeg_style;
 }
+
+pixctrl_result_t pixctrl_get_rgb_order(pixctrl_fmt_t fmt, pixctrl_rgb_order_t *order)
+{
+    static const pixctrl_rgb_order_t rgba = INIT_PIXCTRL_ORDER_RGBA, bgra = INIT_PIXCTRL_ORDER_BGRA;
+    static const pixctrl_rgb_order_t argb = INIT_PIXCTRL_ORDER_ARGB, abgr = INIT_PIXCTRL_ORDER_ABGR;
+    static const pixctrl_rgb_order_t rgb = INIT_PIXCTRL_ORDER_RGB, bgr = INIT_PIXCTRL_ORDER_BGR;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    if (order != NULL)
+    {
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_RGBA32:
+        case PIXCTRL_FMT_RGBX32:
+            *order = rgba;
+            break;
+        case PIXCTRL_FMT_BGRA32:
+        case PIXCTRL_FMT_BGRX32:
+            *order = bgra;
+            break;
+        case PIXCTRL_FMT_ARGB32:
+        case PIXCTRL_FMT_XRGB32:
+            *order = argb;
+            break;
+        case PIXCTRL_FMT_ABGR32:
+        case PIXCTRL_FMT_XBGR32:
+            *order = abgr;
+            break;
+        case PIXCTRL_FMT_RGB24:
+            *order = rgb;
+            break;
+        case PIXCTRL_FMT_BGR24:
+            *order = bgr;
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_get_yuv_order(pixctrl_fmt_t fmt, pixctrl_yuv_order_t *order)
+{
+    static const pixctrl_yuv_order_t yuv444 = INIT_PIXCTRL_ORDER_YUV444;
+    static const pixctrl_yuv_order_t yuyv = INIT_PIXCTRL_ORDER_YUYV422, yvyu = INIT_PIXCTRL_ORDER_YVYU422;
+    static const pixctrl_yuv_order_t uyvy = INIT_PIXCTRL_ORDER_UYVY422, vyuy = INIT_PIXCTRL_ORDER_VYUY422;
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    if (order != NULL)
+    {
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_YUV444:
+            *order = yuv444;
+            break;
+        case PIXCTRL_FMT_YUYV422:
+            *order = yuyv;
+            break;
+        case PIXCTRL_FMT_YVYU422:
+            *order = yvyu;
+            break;
+        case PIXCTRL_FMT_UYVY422:
+            *order = uyvy;
+            break;
+        case PIXCTRL_FMT_VYUY422:
+            *order = vyuy;
+            break;
+        case PIXCTRL_FMT_NV12:
+            *order = nv12;
+            break;
+        case PIXCTRL_FMT_NV21:
+            *order = nv21;
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_get_format_alignment(pixctrl_fmt_t fmt, int32_t *align_x, int32_t *align_y)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    int32_t x = 1, y = 1;
+
+    if ((align_x != NULL) && (align_y != NULL))
+    {
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_YUYV422:
+        case PIXCTRL_FMT_YVYU422:
+        case PIXCTRL_FMT_UYVY422:
+        case PIXCTRL_FMT_VYUY422:
+        case PIXCTRL_FMT_YUV422P:
+            x = 2;
+            break;
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+        case PIXCTRL_FMT_YUV420P:
+            x = 2;
+            y = 2;
+            break;
+        case PIXCTRL_FMT_NV12_16X16:
+        case PIXCTRL_FMT_NV12_64X32:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        default:
+            break;
+        }
+        *align_x = x;
+        *align_y = y;
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_get_gray8_view(pixctrl_fmt_t fmt, uint8_t *src, int32_t width, int32_t height, uint8_t **gray)
+{
+    pixctrl_result_t result;
+
+    if ((src != NULL) && (gray != NULL))
+    {
+        if ((0 < width) && (0 < height))
+        {
+            switch (fmt)
+            {
+            /* the 'Y' plane leads these layouts with a stride of 'width', so it already is a gray8 image */
+            case PIXCTRL_FMT_YUV444P:
+            case PIXCTRL_FMT_YUV422P:
+            case PIXCTRL_FMT_NV12:
+            case PIXCTRL_FMT_NV21:
+            case PIXCTRL_FMT_YUV420P:
+            case PIXCTRL_FMT_GRAY8:
+                *gray = src;
+                result = PIXCTRL_SUCCESS;
+                break;
+            default:
+                *gray = NULL;
+                result = PIXCTRL_NOT_SUPPORT;
+                break;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_get_aligned_rect(const pixctrl_rect_t *rect, int32_t align_x, int32_t align_y,
+                                          int32_t width, int32_t height, pixctrl_rect_t *aligned)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    int32_t x0, y0, x1, y1;
+
+    if ((rect != NULL) && (aligned != NULL))
+    {
+        if ((0 < align_x) && (0 < align_y) && (0 < width) && (0 < height) && (0 <= rect->width) && (0 <= rect->height))
+        {
+            x0 = (rect->x < 0) ? 0 : rect->x;
+            y0 = (rect->y < 0) ? 0 : rect->y;
+            x1 = ((rect->x + rect->width) > width) ? width : (rect->x + rect->width);
+            y1 = ((rect->y + rect->height) > height) ? height : (rect->y + rect->height);
+
+            if ((x0 < x1) && (y0 < y1))
+            {
+                x0 -= x0 % align_x;
+                y0 -= y0 % align_y;
+                x1 = (((x1 + align_x) - 1) / align_x) * align_x;
+                y1 = (((y1 + align_y) - 1) / align_y) * align_y;
+                aligned->x = x0;
+                aligned->y = y0;
+                aligned->width = ((x1 > width) ? width : x1) - x0;
+                aligned->height = ((y1 > height) ? height : y1) - y0;
+            }
+            else
+            {
+                aligned->x = x0;
+                aligned->y = y0;
+                aligned->width = 0;
+                aligned->height = 0;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
@@ -0,0 +1,209 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "pixctrl.h"
+#include "common/instrument.h"
+
+struct pixctrl_change_detect {
+    pixctrl_fmt_t src_fmt;
+    pixctrl_fmt_t dst_fmt;
+    int32_t width;
+    int32_t height;
+    int32_t bpp;                /* bytes per source pixel */
+    int32_t tile_size;
+    int32_t tiles_x;
+    int32_t tiles_y;
+    int32_t valid;              /* 'hash' describes the previous frame */
+    uint64_t *hash;             /* one fingerprint per tile, row-major */
+    pixctrl_rect_t *changed;    /* tiles to reconvert for the current frame */
+};
+
+/********************************************************************************************
+ *  Change Detector
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_change_detect_create(pixctrl_fmt_t src_fmt, int32_t width, int32_t height,
+                                                      pixctrl_fmt_t dst_fmt, int32_t tile_size,
+                                                      pixctrl_change_detect_t **detect)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    pixctrl_rgb_order_t order;
+    pixctrl_change_detect_t *ctx = NULL;
+    size_t tiles;
+
+    if (detect == NULL)
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+    else if ((width <= 0) || (height <= 0) || ((width % 2) != 0) || ((height % 2) != 0) ||
+             (tile_size <= 0) || ((tile_size % 2) != 0))
+    {
+        result = PIXCTRL_INVALID_RANGE;
+    }
+    else if ((dst_fmt != PIXCTRL_FMT_NV12) && (dst_fmt != PIXCTRL_FMT_NV21) && (dst_fmt != PIXCTRL_FMT_YUV420P))
+    {
+        result = PIXCTRL_NOT_SUPPORT;
+    }
+    else
+    {
+        result = pixctrl_get_rgb_order(src_fmt, &order);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        ctx = (pixctrl_change_detect_t *)calloc(1U, sizeof(pixctrl_change_detect_t));
+        if (ctx != NULL)
+        {
+            ctx->src_fmt = src_fmt;
+            ctx->dst_fmt = dst_fmt;
+            ctx->width = width;
+            ctx->height = height;
+            ctx->bpp = order.bpp;
+            ctx->tile_size = tile_size;
+            ctx->tiles_x = ((width + tile_size) - 1) / tile_size;
+            ctx->tiles_y = ((height + tile_size) - 1) / tile_size;
+            tiles = (size_t)ctx->tiles_x * (size_t)ctx->tiles_y;
+            ctx->hash = (uint64_t *)malloc(tiles * sizeof(uint64_t));
+            ctx->changed = (pixctrl_rect_t *)malloc(tiles * sizeof(pixctrl_rect_t));
+            if ((ctx->hash == NULL) || (ctx->changed == NULL))
+            {
+                result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+
+        if (result != PIXCTRL_SUCCESS)
+        {
+            pixctrl_generic_change_detect_destroy(ctx);
+            ctx = NULL;
+        }
+    }
+
+    if (detect != NULL)
+    {
+        *detect = ctx;
+    }
+
+    return result;
+}
+
+void pixctrl_generic_change_detect_destroy(pixctrl_change_detect_t *detect)
+{
+    if (detect != NULL)
+    {
+        free(detect->hash);
+        free(detect->changed);
+        free(detect);
+    }
+}
+
+void pixctrl_generic_change_detect_reset(pixctrl_change_detect_t *detect)
+{
+    if (detect != NULL)
+    {
+        detect->valid = 0;
+    }
+}
+
+int32_t pixctrl_generic_change_detect_tiles(const pixctrl_change_detect_t *detect)
+{
+    return (detect != NULL) ? (detect->tiles_x * detect->tiles_y) : 0;
+}
+
+pixctrl_result_t pixctrl_generic_change_detect_convert(pixctrl_change_detect_t *detect, uint8_t *src, uint8_t *dst,
+                                                       pixctrl_rect_t *changed, int32_t *changed_count)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    pixctrl_rect_t *tile;
+    uint64_t hash;
+    uint8_t *src_row_base;
+    size_t src_stride, tile_len;
+    int32_t count = 0;
+    register int32_t tx, ty, row, row_end;
+    const int32_t width = (detect != NULL) ? detect->width : 0;
+    const int32_t height = (detect != NULL) ? detect->height : 0;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if ((detect != NULL) && (src != NULL) && (dst != NULL))
+    {
+        src_stride = (size_t)detect->width * (size_t)detect->bpp;
+        for (ty = 0; ty < detect->tiles_y; ++ty)
+        {
+            row_end = (((ty + 1) * detect->tile_size) < detect->height) ? ((ty + 1) * detect->tile_size) : detect->height;
+            for (tx = 0; tx < detect->tiles_x; ++tx)
+            {
+                tile = &detect->changed[count];
+                tile->x = tx * detect->tile_size;
+                tile->y = ty * detect->tile_size;
+                tile->width = ((tile->x + detect->tile_size) < detect->width) ? detect->tile_size : (detect->width - tile->x);
+                tile->height = row_end - tile->y;
+
+                /* each row segment of the tile is chained into the fingerprint through the seed */
+                tile_len = (size_t)tile->width * (size_t)detect->bpp;
+                src_row_base = src + (((size_t)tile->y * src_stride) + ((size_t)tile->x * (size_t)detect->bpp));
+                hash = 0U;
+                for (row = tile->y; row < row_end; ++row)
+                {
+                    hash = pixctrl_generic_hash_line_stripe(src_row_base, tile_len, hash);
+                    src_row_base += src_stride;
+                }
+
+                if ((detect->valid == 0) || (detect->hash[(ty * detect->tiles_x) + tx] != hash))
+                {
+                    detect->hash[(ty * detect->tiles_x) + tx] = hash;
+                    ++count;
+                }
+            }
+        }
+
+        result = pixctrl_generic_convert_dirty_rects(detect->src_fmt, src, detect->width, detect->height,
+                                                     detect->dst_fmt, dst, detect->changed, count);
+        detect->valid = (result == PIXCTRL_SUCCESS) ? 1 : 0;
+
+        if (changed != NULL)
+        {
+            (void)memcpy(changed, detect->changed, (size_t)count * sizeof(pixctrl_rect_t));
+        }
+        if (changed_count != NULL)
+        {
+            *changed_count = count;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
@@ -0,0 +1,91 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "pixctrl.h"
+
+#define PIXCTRL_HASH_PRIME1     (0x9e3779b185ebca87ULL)
+#define PIXCTRL_HASH_PRIME2     (0xc2b2ae3d27d4eb4fULL)
+#define PIXCTRL_HASH_PRIME3     (0x165667b19e3779f9ULL)
+
+/********************************************************************************************
+ *  Hash Kernel
+ ********************************************************************************************
+ */
+static inline uint64_t pixctrl_generic_hash_round(uint64_t acc, uint64_t word)
+{
+    acc += word * PIXCTRL_HASH_PRIME2;
+    acc = (acc << 31) | (acc >> 33);
+    return acc * PIXCTRL_HASH_PRIME1;
+}
+
+/********************************************************************************************
+ *  Hash Line-Stripe
+ ********************************************************************************************
+ */
+uint64_t pixctrl_generic_hash_line_stripe(uint8_t *src, size_t len, uint64_t seed)
+{
+    /* four independent lanes over 32-byte stripes keep the multipliers busy, the tail goes through lane 0 */
+    register uint64_t lane0 = seed + PIXCTRL_HASH_PRIME1, lane1 = seed + PIXCTRL_HASH_PRIME2;
+    register uint64_t lane2 = seed, lane3 = seed - PIXCTRL_HASH_PRIME1;
+    uint64_t word[4];
+    register size_t pos = 0U;
+
+    for (; (pos + 32U) <= len; pos += 32U)
+    {
+        (void)memcpy(word, &src[pos], sizeof(word));
+        lane0 = pixctrl_generic_hash_round(lane0, word[0]);
+        lane1 = pixctrl_generic_hash_round(lane1, word[1]);
+        lane2 = pixctrl_generic_hash_round(lane2, word[2]);
+        lane3 = pixctrl_generic_hash_round(lane3, word[3]);
+    }
+    for (; (pos + 8U) <= len; pos += 8U)
+    {
+        (void)memcpy(word, &src[pos], sizeof(word[0]));
+        lane0 = pixctrl_generic_hash_round(lane0, word[0]);
+    }
+    for (; pos < len; ++pos)
+    {
+        lane0 = pixctrl_generic_hash_round(lane0, (uint64_t)src[pos] + PIXCTRL_HASH_PRIME3);
+    }
+
+    lane0 ^= pixctrl_generic_hash_round(0U, lane1);
+    lane0 = (lane0 * PIXCTRL_HASH_PRIME1) + PIXCTRL_HASH_PRIME3;
+    lane0 ^= pixctrl_generic_hash_round(0U, lane2);
+    lane0 = (lane0 * PIXCTRL_HASH_PRIME1) + PIXCTRL_HASH_PRIME3;
+    lane0 ^= pixctrl_generic_hash_round(0U, lane3);
+    lane0 = (lane0 * PIXCTRL_HASH_PRIME1) + PIXCTRL_HASH_PRIME3;
+    lane0 ^= (uint64_t)len;
+
+    /* final avalanche so neighbouring rows chained through 'seed' do not cancel out */
+    lane0 ^= lane0 >> 33;
+    lane0 *= PIXCTRL_HASH_PRIME2;
+    lane0 ^= lane0 >> 29;
+    lane0 *= PIXCTRL_HASH_PRIME3;
+    lane0 ^= lane0 >> 32;
+
+    return lane0;
+}
@@ -0,0 +1,479 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static inline size_t pixctrl_generic_tiled_plane_size(const pixctrl_tile_t *tile, int32_t width, int32_t height)
+{
+    const size_t tiled_width = (size_t)(((width + tile->width) - 1) / tile->width) * (size_t)tile->width;
+    const size_t tiled_height = (size_t)(((height + tile->height) - 1) / tile->height) * (size_t)tile->height;
+
+    return tiled_width * tiled_height;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_tiled_to_yuv420(const pixctrl_tile_t tile,
+                                                                    uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *y_src = src;
+    uint8_t *uv_src = NULL;
+    uint8_t *dst_row_base = dst;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            uv_src = y_src + pixctrl_generic_tiled_plane_size(&tile, width, height);
+            for (row = 0; row < height; ++row)
+            {
+                pixctrl_generic_detile_line_stripe(y_src, &tile, row, dst_row_base, width);
+                dst_row_base += width;
+            }
+
+            for (row = 0; row < (height / 2); ++row)
+            {
+                pixctrl_generic_detile_line_stripe(uv_src, &tile, row, dst_row_base, width);
+                dst_row_base += width;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_tiled_to_yuv420p(const pixctrl_tile_t tile,
+                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    const size_t y_len = (size_t)width * (size_t)height;
+    uint8_t *y_src = src;
+    uint8_t *uv_src = NULL;
+    uint8_t *uv_line = NULL;
+    uint8_t *y_dst_row_base = dst;
+    uint8_t *u_dst_row_base = NULL, *v_dst_row_base = NULL;
+    register int32_t row, col;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            uv_line = (uint8_t *)malloc((size_t)width);
+            if (uv_line != NULL)
+            {
+                uv_src = y_src + pixctrl_generic_tiled_plane_size(&tile, width, height);
+                for (row = 0; row < height; ++row)
+                {
+                    pixctrl_generic_detile_line_stripe(y_src, &tile, row, y_dst_row_base, width);
+                    y_dst_row_base += width;
+                }
+
+                u_dst_row_base = dst + y_len;
+                v_dst_row_base = u_dst_row_base + (y_len / 4U);
+                for (row = 0; row < (height / 2); ++row)
+                {
+                    pixctrl_generic_detile_line_stripe(uv_src, &tile, row, uv_line, width);
+                    for (col = 0; col < (width / 2); ++col)
+                    {
+                        u_dst_row_base[col] = uv_line[(col * 2) + 0];
+                        v_dst_row_base[col] = uv_line[(col * 2) + 1];
+                    }
+                    u_dst_row_base += width / 2;
+                    v_dst_row_base += width / 2;
+                }
+                free(uv_line);
+            }
+            else
+            {
+                result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+/* luma and chroma tiles of the same tile column cover the same pixels, so each tile row converts in place */
+static inline pixctrl_result_t pixctrl_generic_core_tiled_to_xrgb(const pixctrl_tile_t tile,
+                                                                  const pixctrl_rgb_order_t dst_order,
+                                                                  uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12;
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    const int32_t tiles_per_row = ((width + tile.width) - 1) / tile.width;
+    const size_t tile_size = (size_t)tile.width * (size_t)tile.height;
+    const size_t dst_tile_stride = (size_t)tile.width * (size_t)dst_order.bpp;
+    uint8_t *y_plane = src;
+    uint8_t *uv_plane = NULL;
+    uint8_t *y_src_pos, *uv_src_pos, *dst_pos;
+    uint8_t *dst_row_base = dst;
+    register int32_t row, uv_row, col, cols;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            uv_plane = y_plane + pixctrl_generic_tiled_plane_size(&tile, width, height);
+            for (row = 0; row < height; ++row)
+            {
+                uv_row = row / 2;
+                y_src_pos = y_plane + ((size_t)(row / tile.height) * (size_t)tiles_per_row * tile_size)
+                                    + ((size_t)(row % tile.height) * (size_t)tile.width);
+                uv_src_pos = uv_plane + ((size_t)(uv_row / tile.height) * (size_t)tiles_per_row * tile_size)
+                                      + ((size_t)(uv_row % tile.height) * (size_t)tile.width);
+                dst_pos = dst_row_base;
+
+                for (col = 0; col < width; col += tile.width)
+                {
+                    cols = ((width - col) < tile.width) ? (width - col) : tile.width;
+                    pixctrl_generic_yuv420_to_xrgb_line_stripe(y_src_pos, uv_src_pos, &nv12,
+                                                               dst_pos, &dst_order,
+                                                               cols);
+                    y_src_pos += tile_size;
+                    uv_src_pos += tile_size;
+                    dst_pos += dst_tile_stride;
+                }
+                dst_row_base += (size_t)width * (size_t)dst_order.bpp;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_tiled(const pixctrl_tile_t tile,
+                                                                    uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    const int32_t tiled_height = (((height + tile.height) - 1) / tile.height) * tile.height;
+    const int32_t uv_tiled_height = ((((height / 2) + tile.height) - 1) / tile.height) * tile.height;
+    uint8_t *y_dst = dst;
+    uint8_t *uv_dst = NULL;
+    uint8_t *zero_line = NULL;
+    uint8_t *src_row_base = src;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            zero_line = (uint8_t *)calloc((size_t)width, 1U);
+            if (zero_line != NULL)
+            {
+                uv_dst = y_dst + pixctrl_generic_tiled_plane_size(&tile, width, height);
+                for (row = 0; row < tiled_height; ++row)
+                {
+                    pixctrl_generic_tile_line_stripe((row < height) ? src_row_base : zero_line, width, y_dst, &tile, row);
+                    src_row_base += (row < height) ? width : 0;
+                }
+
+                for (row = 0; row < uv_tiled_height; ++row)
+                {
+                    pixctrl_generic_tile_line_stripe((row < (height / 2)) ? src_row_base : zero_line, width, uv_dst, &tile, row);
+                    src_row_base += (row < (height / 2)) ? width : 0;
+                }
+                free(zero_line);
+            }
+            else
+            {
+                result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Tiled nv12 16x16 to Linear yuv
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_yuv420((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_yuv420p((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Tiled nv12 16x16 to Interleaved rgb
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_16x16_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Tiled nv12 64x32 to Linear yuv
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_yuv420((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_yuv420p((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Tiled nv12 64x32 to Interleaved rgb
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_64x32_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_tiled_to_xrgb((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Linear nv12 to Tiled nv12
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_to_nv12_16x16(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_tiled((const pixctrl_tile_t)INIT_PIXCTRL_TILE_16X16,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_nv12_64x32(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_tiled((const pixctrl_tile_t)INIT_PIXCTRL_TILE_64X32,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
@@ -0,0 +1,134 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Tile Kernel
+ ********************************************************************************************
+ */
+/* first byte of 'row' inside a tiled plane that is 'width' bytes wide */
+static inline uint8_t *pixctrl_generic_tile_row_base(uint8_t *plane, const int32_t tile_width, const int32_t tile_height,
+                                                     int32_t row, int32_t width)
+{
+    const int32_t tiles_per_row = (width + tile_width - 1) / tile_width;
+    const size_t tile_size = (size_t)tile_width * (size_t)tile_height;
+
+    return plane + ((size_t)(row / tile_height) * (size_t)tiles_per_row * tile_size)
+                 + ((size_t)(row % tile_height) * (size_t)tile_width);
+}
+
+static inline void pixctrl_generic_detile_kernel(uint8_t *src, const int32_t tile_width, const int32_t tile_height,
+                                                 int32_t row, uint8_t *dst, int32_t width)
+{
+    const int32_t tiles = width / tile_width;
+    const int32_t rest = width % tile_width;
+    const size_t tile_size = (size_t)tile_width * (size_t)tile_height;
+    register uint8_t *src_pos = pixctrl_generic_tile_row_base(src, tile_width, tile_height, row, width);
+    register uint8_t *dst_pos = dst;
+    register int32_t tile;
+
+    for (tile = 0; tile < tiles; ++tile)
+    {
+        (void)memcpy(dst_pos, src_pos, (size_t)tile_width);
+        dst_pos += tile_width;
+        src_pos += tile_size;
+    }
+
+    if (rest != 0)
+    {
+        (void)memcpy(dst_pos, src_pos, (size_t)rest);
+    }
+}
+
+static inline void pixctrl_generic_tile_kernel(uint8_t *src, int32_t width,
+                                               uint8_t *dst, const int32_t tile_width, const int32_t tile_height, int32_t row)
+{
+    const int32_t tiles = width / tile_width;
+    const int32_t rest = width % tile_width;
+    const size_t tile_size = (size_t)tile_width * (size_t)tile_height;
+    register uint8_t *src_pos = src;
+    register uint8_t *dst_pos = pixctrl_generic_tile_row_base(dst, tile_width, tile_height, row, width);
+    register int32_t tile;
+
+    for (tile = 0; tile < tiles; ++tile)
+    {
+        (void)memcpy(dst_pos, src_pos, (size_t)tile_width);
+        src_pos += tile_width;
+        dst_pos += tile_size;
+    }
+
+    if (rest != 0)
+    {
+        /* the padding of the last tile is cleared so the whole tiled frame is defined */
+        (void)memcpy(dst_pos, src_pos, (size_t)rest);
+        (void)memset(dst_pos + rest, 0, (size_t)(tile_width - rest));
+    }
+}
+
+/********************************************************************************************
+ *  Tiled to Linear Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_detile_line_stripe(uint8_t *src, const pixctrl_tile_t *tile, int32_t row,
+                                        uint8_t *dst, int32_t width)
+{
+    /* dispatch the known tiles to constant-size copies so the compiler can inline them */
+    if ((tile->width == 16) && (tile->height == 16))
+    {
+        pixctrl_generic_detile_kernel(src, 16, 16, row, dst, width);
+    }
+    else if ((tile->width == 64) && (tile->height == 32))
+    {
+        pixctrl_generic_detile_kernel(src, 64, 32, row, dst, width);
+    }
+    else
+    {
+        pixctrl_generic_detile_kernel(src, tile->width, tile->height, row, dst, width);
+    }
+}
+
+/********************************************************************************************
+ *  Linear to Tiled Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_tile_line_stripe(uint8_t *src, int32_t width,
+                                      uint8_t *dst, const pixctrl_tile_t *tile, int32_t row)
+{
+    if ((tile->width == 16) && (tile->height == 16))
+    {
+        pixctrl_generic_tile_kernel(src, width, dst, 16, 16, row);
+    }
+    else if ((tile->width == 64) && (tile->height == 32))
+    {
+        pixctrl_generic_tile_kernel(src, width, dst, 64, 32, row);
+    }
+    else
+    {
+        pixctrl_generic_tile_kernel(src, width, dst, tile->width, tile->height, row);
+    }
+}
@@ -0,0 +1,133 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+/* 'rect' is 2x2 aligned, so every chroma sample it touches is rebuilt from both of its rows */
+static void pixctrl_generic_core_xrgb_to_yuv420_rect(const pixctrl_rgb_order_t *src_order, uint8_t *src,
+                                                     int32_t width, int32_t height,
+                                                     pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                     const pixctrl_rect_t *rect)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    const pixctrl_yuv_order_t *dst_order = (dst_fmt == PIXCTRL_FMT_NV21) ? &nv21 : &nv12;
+    const size_t y_size = (size_t)width * (size_t)height;
+    uint8_t *src_row_base = src + ((((size_t)rect->y * (size_t)width) + (size_t)rect->x) * (size_t)src_order->bpp);
+    uint8_t *y_dst_row_base = dst + (((size_t)rect->y * (size_t)width) + (size_t)rect->x);
+    uint8_t *uv_dst_row_base, *u_dst_row_base, *v_dst_row_base;
+    register size_t src_stride = (size_t)width * (size_t)src_order->bpp;
+    register int32_t row;
+
+    if (dst_fmt == PIXCTRL_FMT_YUV420P)
+    {
+        u_dst_row_base = dst + y_size + ((((size_t)rect->y / 2U) * ((size_t)width / 2U)) + ((size_t)rect->x / 2U));
+        v_dst_row_base = u_dst_row_base + (y_size / 4U);
+        for (row = rect->y; row < (rect->y + rect->height); ++row)
+        {
+            pixctrl_generic_xrgb_to_yuv420p_line_stripe(src_row_base, src_order,
+                                                        y_dst_row_base, u_dst_row_base, v_dst_row_base,
+                                                        rect->width, row);
+            src_row_base += src_stride;
+            y_dst_row_base += width;
+            if ((row % 2) != 0)
+            {
+                u_dst_row_base += width / 2;
+                v_dst_row_base += width / 2;
+            }
+        }
+    }
+    else
+    {
+        uv_dst_row_base = dst + y_size + ((((size_t)rect->y / 2U) * (size_t)width) + (size_t)rect->x);
+        for (row = rect->y; row < (rect->y + rect->height); ++row)
+        {
+            pixctrl_generic_xrgb_to_yuv420_line_stripe(src_row_base, src_order,
+                                                       y_dst_row_base, uv_dst_row_base, dst_order,
+                                                       rect->width, row);
+            src_row_base += src_stride;
+            y_dst_row_base += width;
+            if ((row % 2) != 0)
+            {
+                uv_dst_row_base += width;
+            }
+        }
+    }
+}
+
+/********************************************************************************************
+ *  Dirty Rectangle Converter
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_convert_dirty_rects(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                     pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                     const pixctrl_rect_t *rects, int32_t rect_count)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_rgb_order_t src_order;
+    pixctrl_rect_t aligned;
+    register int32_t i;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if ((rects == NULL) && (rect_count != 0))
+        {
+            result = PIXCTRL_MUST_NOT_BE_NULL;
+        }
+        else if ((((width % 2) != 0) || ((height % 2) != 0)) || (rect_count < 0))
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+        else if ((dst_fmt != PIXCTRL_FMT_NV12) && (dst_fmt != PIXCTRL_FMT_NV21) && (dst_fmt != PIXCTRL_FMT_YUV420P))
+        {
+            result = PIXCTRL_NOT_SUPPORT;
+        }
+        else
+        {
+            result = pixctrl_get_rgb_order(src_fmt, &src_order);
+        }
+    }
+
+    for (i = 0; (result == PIXCTRL_SUCCESS) && (i < rect_count); ++i)
+    {
+        result = pixctrl_get_aligned_rect(&rects[i], 2, 2, width, height, &aligned);
+        if ((result == PIXCTRL_SUCCESS) && (aligned.width > 0))
+        {
+            pixctrl_generic_core_xrgb_to_yuv420_rect(&src_order, src, width, height, dst_fmt, dst, &aligned);
+        }
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
@@ -0,0 +1,97 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Luma-only Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_xrgb_to_gray8_kernel(uint8_t *src, uint8_t *dst, int32_t width,
+                                                        const int32_t bpp, const int32_t ir, const int32_t ig, const int32_t ib)
+{
+    register int32_t col;
+    register uint8_t *src_pos = src;
+
+    for(col = 0; col < width; ++col)
+    {
+        /* Ref) learn.microsoft.com/en-us/windows/win32/medfound/recommended-8-bit-yuv-formats-for-video-rendering
+         *  Y = ( (  66 * R + 129 * G +  25 * B + 128) >> 8) +  16
+         *
+         *  The sum never exceeds 16 bits, so the loop stays in 16-bit lanes once vectorized.
+         */
+        register uint32_t r = (uint32_t)src_pos[ir];
+        register uint32_t g = (uint32_t)src_pos[ig];
+        register uint32_t b = (uint32_t)src_pos[ib];
+        register uint32_t y_val = ((66U * r) + (129U * g) + (25U * b) + 128U) >> 8;
+
+        dst[col] = (uint8_t)(y_val + 16U);
+        src_pos += bpp;
+    }
+}
+
+/********************************************************************************************
+ *  Interleaved to Gray Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_xrgb_to_gray8_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
+                                               uint8_t *dst, int32_t width)
+{
+    register const int32_t ir = src_order->ir;
+    register const int32_t ig = src_order->ig;
+    register const int32_t ib = src_order->ib;
+    register const int32_t src_bpp = src_order->bpp;
+
+    /* dispatch the known orders to constant-index loops so the compiler can vectorize them */
+    if ((src_bpp == 4) && (ir == 0) && (ig == 1) && (ib == 2))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 4, 0, 1, 2);  /* rgba */
+    }
+    else if ((src_bpp == 4) && (ir == 2) && (ig == 1) && (ib == 0))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 4, 2, 1, 0);  /* bgra */
+    }
+    else if ((src_bpp == 4) && (ir == 1) && (ig == 2) && (ib == 3))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 4, 1, 2, 3);  /* argb */
+    }
+    else if ((src_bpp == 4) && (ir == 3) && (ig == 2) && (ib == 1))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 4, 3, 2, 1);  /* abgr */
+    }
+    else if ((src_bpp == 3) && (ir == 0) && (ig == 1) && (ib == 2))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 3, 0, 1, 2);  /* rgb24 */
+    }
+    else if ((src_bpp == 3) && (ir == 2) && (ig == 1) && (ib == 0))
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, 3, 2, 1, 0);  /* bgr24 */
+    }
+    else
+    {
+        pixctrl_generic_xrgb_to_gray8_kernel(src, dst, width, src_bpp, ir, ig, ib);
+    }
+}
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include "pixctrl.h"
 #include "common/util.h"
+#include "common/instrument.h"
 
 /********************************************************************************************
  *  Core Function
@@ -85,30 +86,54 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_xrgb32(const pixctrl
  */
 pixctrl_result_t pixctrl_generic_rgba_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 
@@ -118,30 +143,54 @@ pixctrl_result_t pixctrl_generic_bgra_to_bgr24(uint8_t *src, uint8_t *dst, int32
  */
 pixctrl_result_t pixctrl_generic_argb_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -150,16 +199,28 @@ pixctrl_result_t pixctrl_generic_abgr_to_bgr24(uint8_t *src, uint8_t *dst, int32
  */
 pixctrl_result_t pixctrl_generic_rgba_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 
@@ -169,16 +230,28 @@ pixctrl_result_t pixctrl_generic_bgra_to_rgba(uint8_t *src, uint8_t *dst, int32_
  */
 pixctrl_result_t pixctrl_generic_rgba_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -187,16 +260,28 @@ pixctrl_result_t pixctrl_generic_bgra_to_argb(uint8_t *src, uint8_t *dst, int32_
  */
 pixctrl_result_t pixctrl_generic_argb_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -205,16 +290,28 @@ pixctrl_result_t pixctrl_generic_abgr_to_rgba(uint8_t *src, uint8_t *dst, int32_
  */
 pixctrl_result_t pixctrl_generic_argb_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
-                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_xrgb32((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -223,14 +320,26 @@ pixctrl_result_t pixctrl_generic_abgr_to_argb(uint8_t *src, uint8_t *dst, int32_
  */
 pixctrl_result_t pixctrl_generic_rgb24_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
-                                              (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
-                                              src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_rgb24((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include "pixctrl.h"
 #include "common/util.h"
+#include "generic/stats/luma_stats.h"
+#include "common/instrument.h"
 
 /********************************************************************************************
  *  Core Function
@@ -62,26 +64,27 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv422(const pixctrl
                                                                    int32_t width, int32_t height)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_plane_layout_t layout;
     uint8_t *src_row_base = src, *dst_row_base = dst;
-    register int32_t src_stride = width * src_order.bpp, dst_stride = width * dst_order.bpp;
+    register int32_t src_stride = width * src_order.bpp, dst_stride;
     register int32_t row;
 
     if (result == PIXCTRL_SUCCESS)
     {
-        if ((width % 2) == 0)
-        {
-            for (row = 0; row < height; ++row)
-            {
-                pixctrl_generic_xrgb_to_yuv422_line_stripe(src_row_base, &src_order, 
-                                                                      dst_row_base, &dst_order, 
-                                                                      width);
-                src_row_base += src_stride;
-                dst_row_base += dst_stride;
-            }
-        }
-        else
+        /* every packed 4:2:2 order shares the geometry of yuyv422 */
+        result = pixctrl_get_plane_layout(PIXCTRL_FMT_YUYV422, width, height, &layout);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        dst_stride = layout.stride[0];
+        for (row = 0; row < height; ++row)
         {
-            result = PIXCTRL_INVALID_RANGE;
+            pixctrl_generic_xrgb_to_yuv422_line_stripe(src_row_base, &src_order, 
+                                                                  dst_row_base, &dst_order, 
+                                                                  width);
+            src_row_base += src_stride;
+            dst_row_base += dst_stride;
         }
     }
 
@@ -91,37 +94,43 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv422(const pixctrl
 static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv420(const pixctrl_rgb_order_t src_order, 
                                                                    const pixctrl_yuv_order_t dst_order, 
                                                                    uint8_t *src, uint8_t *dst, 
-                                                                   int32_t width, int32_t height)
+                                                                   int32_t width, int32_t height,
+                                                                   pixctrl_luma_stats_t *stats)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_plane_layout_t layout;
     uint8_t *src_row_base = src;
     uint8_t *y_dst_row_base = dst, *uv_dst_row_base = NULL;
     register int32_t src_stride = width * src_order.bpp;
     register int32_t y_stride = width;
-    register int32_t uv_stride = width * (dst_order.bpp / 2);
+    register int32_t uv_stride;
     register int32_t row;
 
     if (result == PIXCTRL_SUCCESS)
     {
-        if (((width % 2) == 0) && ((height % 2) == 0))
+        /* nv21 shares the geometry of nv12 */
+        result = pixctrl_get_plane_layout(PIXCTRL_FMT_NV12, width, height, &layout);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        uv_dst_row_base = dst + layout.offset[1];
+        uv_stride = layout.stride[1];
+        for (row = 0; row < height; ++row)
         {
-            uv_dst_row_base = y_dst_row_base + (y_stride * height);
-            for (row = 0; row < height; ++row)
+            pixctrl_generic_xrgb_to_yuv420_line_stripe(src_row_base, &src_order, 
+                                                                  y_dst_row_base, uv_dst_row_base, &dst_order, 
+                                                                  width, row);
+            if (stats != NULL)
             {
-                pixctrl_generic_xrgb_to_yuv420_line_stripe(src_row_base, &src_order, 
-                                                                      y_dst_row_base, uv_dst_row_base, &dst_order, 
-                                                                      width, row);
-                src_row_base += src_stride;
-                y_dst_row_base += y_stride;
-                if((row % 2) != 0)
-                {
-                    uv_dst_row_base += uv_stride;
-                }
+                pixctrl_generic_luma_stats_line_stripe(y_dst_row_base, row, stats);
+            }
+            src_row_base += src_stride;
+            y_dst_row_base += y_stride;
+            if((row % 2) != 0)
+            {
+                uv_dst_row_base += uv_stride;
             }
-        }
-        else
-        {
-            result = PIXCTRL_INVALID_RANGE;
         }
     }
 
@@ -167,37 +176,37 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv422p(const pixctr
                                                                     int32_t width, int32_t height)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_plane_layout_t layout;
     uint8_t *src_row_base = src;
     uint8_t *y_dst_row_base = NULL;
     uint8_t *u_dst_row_base = NULL;
     uint8_t *v_dst_row_base = NULL;
     register int32_t src_stride = width * src_order.bpp;
     register int32_t y_stride = width;
-    register int32_t uv_stride = width / 2;
+    register int32_t uv_stride;
     register int32_t row;
 
     if (result == PIXCTRL_SUCCESS)
     {
-        if ((width % 2) == 0)
-        {
-            y_dst_row_base = dst;
-            u_dst_row_base = y_dst_row_base + (y_stride * height);
-            v_dst_row_base = u_dst_row_base + (uv_stride * height);
+        result = pixctrl_get_plane_layout(PIXCTRL_FMT_YUV422P, width, height, &layout);
+    }
 
-            for (row = 0; row < height; ++row)
-            {
-                pixctrl_generic_xrgb_to_yuv422p_line_stripe(src_row_base, &src_order, 
-                                                                 y_dst_row_base, u_dst_row_base, v_dst_row_base, 
-                                                                 width);
-                src_row_base += src_stride;
-                y_dst_row_base += y_stride;
-                u_dst_row_base += uv_stride;
-                v_dst_row_base += uv_stride;
-            }
-        }
-        else
+    if (result == PIXCTRL_SUCCESS)
+    {
+        y_dst_row_base = dst;
+        u_dst_row_base = dst + layout.offset[1];
+        v_dst_row_base = dst + layout.offset[2];
+        uv_stride = layout.stride[1];
+
+        for (row = 0; row < height; ++row)
         {
-            result = PIXCTRL_INVALID_RANGE;
+            pixctrl_generic_xrgb_to_yuv422p_line_stripe(src_row_base, &src_order, 
+                                                             y_dst_row_base, u_dst_row_base, v_dst_row_base, 
+                                                             width);
+            src_row_base += src_stride;
+            y_dst_row_base += y_stride;
+            u_dst_row_base += uv_stride;
+            v_dst_row_base += uv_stride;
         }
     }
 
@@ -206,43 +215,49 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv422p(const pixctr
 
 static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv420p(const pixctrl_rgb_order_t src_order, 
                                                                     uint8_t *src, uint8_t *dst, 
-                                                                    int32_t width, int32_t height)
+                                                                    int32_t width, int32_t height,
+                                                                    pixctrl_luma_stats_t *stats)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_plane_layout_t layout;
     uint8_t *src_row_base = src;
     uint8_t *y_dst_row_base = NULL;
     uint8_t *u_dst_row_base = NULL;
     uint8_t *v_dst_row_base = NULL;
     register int32_t src_stride = width * src_order.bpp;
     register int32_t y_stride = width;
-    register int32_t uv_stride = width / 2;
+    register int32_t uv_stride;
     register int32_t row;
 
     if (result == PIXCTRL_SUCCESS)
     {
-        if (((width % 2) == 0) && ((height % 2) == 0))
-        {
-            y_dst_row_base = dst;
-            u_dst_row_base = y_dst_row_base + (y_stride * height);
-            v_dst_row_base = u_dst_row_base + (uv_stride * (height / 2));
+        result = pixctrl_get_plane_layout(PIXCTRL_FMT_YUV420P, width, height, &layout);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        /* odd height: the last (even) row owns a chroma row of its own */
+        y_dst_row_base = dst;
+        u_dst_row_base = dst + layout.offset[1];
+        v_dst_row_base = dst + layout.offset[2];
+        uv_stride = layout.stride[1];
 
-            for (row = 0; row < height; ++row)
+        for (row = 0; row < height; ++row)
+        {
+            pixctrl_generic_xrgb_to_yuv420p_line_stripe(src_row_base, &src_order, 
+                                                             y_dst_row_base, u_dst_row_base, v_dst_row_base, 
+                                                             width, row);
+            if (stats != NULL)
             {
-                pixctrl_generic_xrgb_to_yuv420p_line_stripe(src_row_base, &src_order, 
-                                                                 y_dst_row_base, u_dst_row_base, v_dst_row_base, 
-                                                                 width, row);
-                src_row_base += src_stride;
-                y_dst_row_base += y_stride;
-                if((row % 2) != 0)
-                {
-                    u_dst_row_base += uv_stride;
-                    v_dst_row_base += uv_stride;
-                }
+                pixctrl_generic_luma_stats_line_stripe(y_dst_row_base, row, stats);
+            }
+            src_row_base += src_stride;
+            y_dst_row_base += y_stride;
+            if((row % 2) != 0)
+            {
+                u_dst_row_base += uv_stride;
+                v_dst_row_base += uv_stride;
             }
-        }
-        else
-        {
-            result = PIXCTRL_INVALID_RANGE;
         }
     }
 
@@ -255,32 +270,68 @@ static inline pixctrl_result_t pixctrl_generic_core_xrgb_to_yuv420p(const pixctr
  */
 pixctrl_result_t pixctrl_generic_rgb24_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -290,173 +341,317 @@ pixctrl_result_t pixctrl_generic_bgra_to_yuv444(uint8_t *src, uint8_t *dst, int3
 /* rgb to Interleaved yuyv422 */
 pixctrl_result_t pixctrl_generic_rgb24_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 /* rgb to Interleaved yvyu422 */
 pixctrl_result_t pixctrl_generic_rgb24_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 /* rgb to Interleaved uyvy422 */
 pixctrl_result_t pixctrl_generic_rgb24_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 /* rgb to Interleaved vyuy422 */
 pixctrl_result_t pixctrl_generic_rgb24_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 
@@ -467,87 +662,159 @@ pixctrl_result_t pixctrl_generic_bgra_to_vyuy422(uint8_t *src, uint8_t *dst, int
 /* rgb to Interleaved nv12 */
 pixctrl_result_t pixctrl_generic_rgb24_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 /* rgb to Interleaved nv21 */
 pixctrl_result_t pixctrl_generic_rgb24_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
-                                               (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                               src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, 
+                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -556,31 +823,67 @@ pixctrl_result_t pixctrl_generic_bgra_to_nv21(uint8_t *src, uint8_t *dst, int32_
  */
 pixctrl_result_t pixctrl_generic_rgb24_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 pixctrl_result_t pixctrl_generic_argb_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv444p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 24U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -589,32 +892,68 @@ pixctrl_result_t pixctrl_generic_bgra_to_yuv444p(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_rgb24_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv422p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 16U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -623,30 +962,100 @@ pixctrl_result_t pixctrl_generic_bgra_to_yuv422p(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_rgb24_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgr24_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_argb_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_abgr_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_rgba_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_bgra_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb_to_yuv420p((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 12U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  rgb to yuv420 with Luma Statistics
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgb_to_yuv420_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                               pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                               pixctrl_luma_stats_t *stats)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_rgb_order_t src_order;
+    pixctrl_result_t result = pixctrl_get_rgb_order(src_fmt, &src_order);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+            result = pixctrl_generic_core_xrgb_to_yuv420(src_order, nv12, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_NV21:
+            result = pixctrl_generic_core_xrgb_to_yuv420(src_order, nv21, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_xrgb_to_yuv420p(src_order, src, dst, width, height, stats);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    return result;
 }
@@ -146,6 +146,16 @@ void pixctrl_generic_xrgb_to_yuv422_line_stripe(uint8_t *src, const pixctrl_rgb_
         prev_dst_pos = dst_pos;
         dst_pos += dst_bpp;
     }
+
+    if ((width % 2) != 0)
+    {
+        /* Set Trailing U, V Value (Unpaired Last Column) */
+        prev_dst_pos[iu] = (uint8_t)u_val;
+        prev_dst_pos[iv] = (uint8_t)v_val;
+
+        /* Replicate Last Y Value into Padding Sample */
+        dst_pos[iy] = prev_dst_pos[iy];
+    }
 }
 
 void pixctrl_generic_xrgb_to_yuv420_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
@@ -225,6 +235,23 @@ void pixctrl_generic_xrgb_to_yuv420_line_stripe(uint8_t *src, const pixctrl_rgb_
 
         src_pos += src_bpp;
     }
+
+    if ((width % 2) != 0)
+    {
+        /* Set Trailing U, V Value (Unpaired Last Column) */
+        if ((row % 2) == 0)
+        {
+            uv_dst_pos[iu] = (uint8_t)u_val;
+            uv_dst_pos[iv] = (uint8_t)v_val;
+        }
+        else
+        {
+            u_val = (u_val + (uint32_t)uv_dst_pos[iu]) >> 1;
+            v_val = (v_val + (uint32_t)uv_dst_pos[iv]) >> 1;
+            uv_dst_pos[iu] = (uint8_t)u_val;
+            uv_dst_pos[iv] = (uint8_t)v_val;
+        }
+    }
 }
 
 /********************************************************************************************
@@ -342,6 +369,14 @@ void pixctrl_generic_xrgb_to_yuv422p_line_stripe(uint8_t *src, const pixctrl_rgb
 
         src_pos += src_bpp;
     }
+
+    if ((width % 2) != 0)
+    {
+        /* Set Trailing U, V Value (Unpaired Last Column) */
+        uv_col = width / 2;
+        u_dst[uv_col] = (uint8_t)u_val;
+        v_dst[uv_col] = (uint8_t)v_val;
+    }
 }
 
 void pixctrl_generic_xrgb_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
@@ -419,4 +454,22 @@ void pixctrl_generic_xrgb_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_rgb
 
         src_pos += src_bpp;
     }
+
+    if ((width % 2) != 0)
+    {
+        /* Set Trailing U, V Value (Unpaired Last Column) */
+        uv_col = width / 2;
+        if ((row % 2) == 0)
+        {
+            u_dst[uv_col] = (uint8_t)u_val;
+            v_dst[uv_col] = (uint8_t)v_val;
+        }
+        else
+        {
+            u_val = (u_val + (uint32_t)u_dst[uv_col]) >> 1;
+            v_val = (v_val + (uint32_t)v_dst[uv_col]) >> 1;
+            u_dst[uv_col] = (uint8_t)u_val;
+            v_dst[uv_col] = (uint8_t)v_val;
+        }
+    }
 }
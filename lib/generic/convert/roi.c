@@ -0,0 +1,471 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+#define PIXCTRL_ROI_MAX_PLANES  (3)
+
+typedef enum {
+    PIXCTRL_ROI_RGB,
+    PIXCTRL_ROI_YUV444,
+    PIXCTRL_ROI_YUV422,
+    PIXCTRL_ROI_YUV420,
+    PIXCTRL_ROI_YUV444P,
+    PIXCTRL_ROI_YUV422P,
+    PIXCTRL_ROI_YUV420P,
+    PIXCTRL_ROI_GRAY8,
+} pixctrl_roi_layout_t;
+
+/* one corner of a region in every plane of a frame */
+typedef struct {
+    pixctrl_roi_layout_t layout;
+    pixctrl_rgb_order_t rgb_order;
+    pixctrl_yuv_order_t yuv_order;
+    int32_t planes;
+    int32_t chroma_rows;                        /* source rows per chroma row, 1 or 2 */
+    uint8_t *plane[PIXCTRL_ROI_MAX_PLANES];
+    size_t stride[PIXCTRL_ROI_MAX_PLANES];
+    size_t row_len[PIXCTRL_ROI_MAX_PLANES];     /* bytes of one region row */
+} pixctrl_roi_view_t;
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static pixctrl_result_t pixctrl_generic_roi_view(pixctrl_fmt_t fmt, uint8_t *base, int32_t frame_width, int32_t frame_height,
+                                                 int32_t x, int32_t y, int32_t width, pixctrl_roi_view_t *view)
+{
+    const size_t fw = (size_t)frame_width, fh = (size_t)frame_height;
+    const size_t ux = (size_t)x, uy = (size_t)y, uw = (size_t)width;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    size_t bpp = 1U;
+
+    view->planes = 1;
+    view->chroma_rows = 1;
+    if (pixctrl_get_rgb_order(fmt, &view->rgb_order) == PIXCTRL_SUCCESS)
+    {
+        view->layout = PIXCTRL_ROI_RGB;
+        bpp = (size_t)view->rgb_order.bpp;
+    }
+    else
+    {
+        (void)pixctrl_get_yuv_order(fmt, &view->yuv_order);
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_YUV444:
+            view->layout = PIXCTRL_ROI_YUV444;
+            bpp = 3U;
+            break;
+        case PIXCTRL_FMT_YUYV422:
+        case PIXCTRL_FMT_YVYU422:
+        case PIXCTRL_FMT_UYVY422:
+        case PIXCTRL_FMT_VYUY422:
+            view->layout = PIXCTRL_ROI_YUV422;
+            bpp = 2U;
+            break;
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            view->layout = PIXCTRL_ROI_YUV420;
+            view->planes = 2;
+            view->chroma_rows = 2;
+            view->plane[1] = base + (fw * fh) + ((uy / 2U) * fw) + ux;
+            view->stride[1] = fw;
+            view->row_len[1] = uw;
+            break;
+        case PIXCTRL_FMT_YUV444P:
+            view->layout = PIXCTRL_ROI_YUV444P;
+            view->planes = 3;
+            view->plane[1] = base + (fw * fh) + (uy * fw) + ux;
+            view->plane[2] = view->plane[1] + (fw * fh);
+            view->stride[1] = fw;
+            view->row_len[1] = uw;
+            break;
+        case PIXCTRL_FMT_YUV422P:
+            view->layout = PIXCTRL_ROI_YUV422P;
+            view->planes = 3;
+            view->plane[1] = base + (fw * fh) + (uy * (fw / 2U)) + (ux / 2U);
+            view->plane[2] = view->plane[1] + ((fw / 2U) * fh);
+            view->stride[1] = fw / 2U;
+            view->row_len[1] = uw / 2U;
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            view->layout = PIXCTRL_ROI_YUV420P;
+            view->planes = 3;
+            view->chroma_rows = 2;
+            view->plane[1] = base + (fw * fh) + ((uy / 2U) * (fw / 2U)) + (ux / 2U);
+            view->plane[2] = view->plane[1] + ((fw / 2U) * (fh / 2U));
+            view->stride[1] = fw / 2U;
+            view->row_len[1] = uw / 2U;
+            break;
+        case PIXCTRL_FMT_GRAY8:
+            view->layout = PIXCTRL_ROI_GRAY8;
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    view->plane[0] = base + (((uy * fw) + ux) * bpp);
+    view->stride[0] = fw * bpp;
+    view->row_len[0] = uw * bpp;
+    view->stride[2] = view->stride[1];
+    view->row_len[2] = view->row_len[1];
+
+    return result;
+}
+
+/* converts one region row with the line stripe of the layout pair, 'row' counts from the top of the region */
+static pixctrl_result_t pixctrl_generic_roi_row(const pixctrl_roi_view_t *src, const pixctrl_roi_view_t *dst,
+                                                int32_t width, int32_t row)
+{
+    uint8_t *const *s = src->plane, *const *d = dst->plane;
+    const pixctrl_rgb_order_t *src_rgb = &src->rgb_order, *dst_rgb = &dst->rgb_order;
+    const pixctrl_yuv_order_t *src_yuv = &src->yuv_order, *dst_yuv = &dst->yuv_order;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    switch (src->layout)
+    {
+    case PIXCTRL_ROI_RGB:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_RGB:
+            if (dst_rgb->bpp == 3)
+            {
+                pixctrl_generic_xrgb_to_rgb24_line_stripe(s[0], src_rgb, d[0], dst_rgb, width);
+            }
+            else if (src_rgb->bpp == 4)
+            {
+                pixctrl_generic_xrgb32_to_argb32_line_stripe(s[0], src_rgb, d[0], dst_rgb, width);
+            }
+            else
+            {
+                result = PIXCTRL_NOT_SUPPORT;
+            }
+            break;
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_xrgb_to_yuv444_line_stripe(s[0], src_rgb, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_xrgb_to_yuv422_line_stripe(s[0], src_rgb, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_xrgb_to_yuv420_line_stripe(s[0], src_rgb, d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_xrgb_to_yuv444p_line_stripe(s[0], src_rgb, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_xrgb_to_yuv422p_line_stripe(s[0], src_rgb, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_xrgb_to_yuv420p_line_stripe(s[0], src_rgb, d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            pixctrl_generic_xrgb_to_gray8_line_stripe(s[0], src_rgb, d[0], width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV444:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_yuv444_to_yuv422_line_stripe(s[0], src_yuv, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_yuv444_to_yuv420_line_stripe(s[0], src_yuv, d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_yuv444_to_yuv444p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_yuv444_to_yuv422p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_yuv444_to_yuv420p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            pixctrl_generic_yuv444_to_gray8_line_stripe(s[0], src_yuv, d[0], width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV422:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_yuv422_to_yuv444_line_stripe(s[0], src_yuv, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_yuv422_to_yuv420_line_stripe(s[0], src_yuv, d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_yuv422_to_yuv444p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_yuv422_to_yuv422p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_yuv422_to_yuv420p_line_stripe(s[0], src_yuv, d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            pixctrl_generic_yuv422_to_gray8_line_stripe(s[0], src_yuv, d[0], width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV420:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_RGB:
+            pixctrl_generic_yuv420_to_xrgb_line_stripe(s[0], s[1], src_yuv, d[0], dst_rgb, width);
+            break;
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_yuv420_to_yuv444_line_stripe(s[0], s[1], src_yuv, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_yuv420_to_yuv422_line_stripe(s[0], s[1], src_yuv, d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_yuv420_to_yuv444p_line_stripe(s[0], s[1], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_yuv420_to_yuv422p_line_stripe(s[0], s[1], src_yuv, d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_yuv420_to_yuv420p_line_stripe(s[0], s[1], src_yuv, d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            (void)memcpy(d[0], s[0], (size_t)width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV444P:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_yuv444p_to_yuv444_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_yuv444p_to_yuv422_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_yuv444p_to_yuv420_line_stripe(s[0], s[1], s[2], d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_yuv444p_to_yuv422p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_yuv444p_to_yuv420p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            (void)memcpy(d[0], s[0], (size_t)width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV422P:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_yuv422p_to_yuv444_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_yuv422p_to_yuv422_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_yuv422p_to_yuv420_line_stripe(s[0], s[1], s[2], d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_yuv422p_to_yuv444p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV420P:
+            pixctrl_generic_yuv422p_to_yuv420p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width, row);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            (void)memcpy(d[0], s[0], (size_t)width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    case PIXCTRL_ROI_YUV420P:
+        switch (dst->layout)
+        {
+        case PIXCTRL_ROI_RGB:
+            pixctrl_generic_yuv420p_to_xrgb_line_stripe(s[0], s[1], s[2], d[0], dst_rgb, width);
+            break;
+        case PIXCTRL_ROI_YUV444:
+            pixctrl_generic_yuv420p_to_yuv444_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV422:
+            pixctrl_generic_yuv420p_to_yuv422_line_stripe(s[0], s[1], s[2], d[0], dst_yuv, width);
+            break;
+        case PIXCTRL_ROI_YUV420:
+            pixctrl_generic_yuv420p_to_yuv420_line_stripe(s[0], s[1], s[2], d[0], d[1], dst_yuv, width, row);
+            break;
+        case PIXCTRL_ROI_YUV444P:
+            pixctrl_generic_yuv420p_to_yuv444p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_YUV422P:
+            pixctrl_generic_yuv420p_to_yuv422p_line_stripe(s[0], s[1], s[2], d[0], d[1], d[2], width);
+            break;
+        case PIXCTRL_ROI_GRAY8:
+            (void)memcpy(d[0], s[0], (size_t)width);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+        break;
+    default:
+        result = PIXCTRL_NOT_SUPPORT;
+        break;
+    }
+
+    return result;
+}
+
+/* same format on both sides, the region is copied plane by plane */
+static void pixctrl_generic_roi_copy_row(const pixctrl_roi_view_t *src, const pixctrl_roi_view_t *dst, int32_t row)
+{
+    register int32_t i;
+
+    (void)memcpy(dst->plane[0], src->plane[0], src->row_len[0]);
+    if ((src->chroma_rows == 1) || ((row % 2) == 0))
+    {
+        for (i = 1; i < src->planes; ++i)
+        {
+            (void)memcpy(dst->plane[i], src->plane[i], src->row_len[i]);
+        }
+    }
+}
+
+static void pixctrl_generic_roi_next_row(pixctrl_roi_view_t *view, int32_t row)
+{
+    register int32_t i;
+
+    view->plane[0] += view->stride[0];
+    if ((view->chroma_rows == 1) || ((row % 2) != 0))
+    {
+        for (i = 1; i < view->planes; ++i)
+        {
+            view->plane[i] += view->stride[i];
+        }
+    }
+}
+
+/********************************************************************************************
+ *  Region of Interest Converter
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_convert_roi(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                             const pixctrl_rect_t *src_rect,
+                                             pixctrl_fmt_t dst_fmt, uint8_t *dst, int32_t dst_width, int32_t dst_height,
+                                             int32_t dst_x, int32_t dst_y)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, src_width, src_height);
+    pixctrl_roi_view_t src_view, dst_view;
+    int32_t src_align_x = 1, src_align_y = 1, dst_align_x = 1, dst_align_y = 1, align_x, align_y;
+    register int32_t row;
+
+    PIXCTRL_TRACE_BEGIN(src_width, src_height);
+
+    if ((result == PIXCTRL_SUCCESS) && (src_rect == NULL))
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_get_format_alignment(src_fmt, &src_align_x, &src_align_y);
+    }
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_get_format_alignment(dst_fmt, &dst_align_x, &dst_align_y);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        /* every offset and size lands on whole chroma samples of both formats */
+        align_x = (src_align_x > dst_align_x) ? src_align_x : dst_align_x;
+        align_y = (src_align_y > dst_align_y) ? src_align_y : dst_align_y;
+        if ((src_rect->width <= 0) || (src_rect->height <= 0) || (dst_width <= 0) || (dst_height <= 0) ||
+            (src_rect->x < 0) || (src_rect->y < 0) || (dst_x < 0) || (dst_y < 0) ||
+            ((src_rect->x + src_rect->width) > src_width) || ((src_rect->y + src_rect->height) > src_height) ||
+            ((dst_x + src_rect->width) > dst_width) || ((dst_y + src_rect->height) > dst_height) ||
+            ((src_width % src_align_x) != 0) || ((src_height % src_align_y) != 0) ||
+            ((dst_width % dst_align_x) != 0) || ((dst_height % dst_align_y) != 0) ||
+            ((src_rect->x % align_x) != 0) || ((src_rect->width % align_x) != 0) || ((dst_x % align_x) != 0) ||
+            ((src_rect->y % align_y) != 0) || ((src_rect->height % align_y) != 0) || ((dst_y % align_y) != 0))
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_roi_view(src_fmt, src, src_width, src_height, src_rect->x, src_rect->y, src_rect->width, &src_view);
+    }
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_roi_view(dst_fmt, dst, dst_width, dst_height, dst_x, dst_y, src_rect->width, &dst_view);
+    }
+
+    /* an unsupported pair fails on the first row before anything is written */
+    for (row = 0; (result == PIXCTRL_SUCCESS) && (row < src_rect->height); ++row)
+    {
+        if (src_fmt == dst_fmt)
+        {
+            pixctrl_generic_roi_copy_row(&src_view, &dst_view, row);
+        }
+        else
+        {
+            result = pixctrl_generic_roi_row(&src_view, &dst_view, src_rect->width, row);
+        }
+        pixctrl_generic_roi_next_row(&src_view, row);
+        pixctrl_generic_roi_next_row(&dst_view, row);
+    }
+
+    PIXCTRL_TRACE_END(src_width, src_height, result);
+
+    return result;
+}
@@ -0,0 +1,235 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_gray8(const pixctrl_yuv_order_t src_order,
+                                                                    uint8_t *src, uint8_t *dst,
+                                                                    int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *src_row_base = src, *dst_row_base = dst;
+    register int32_t src_stride = width * src_order.bpp, dst_stride = width;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        for (row = 0; row < height; ++row)
+        {
+            pixctrl_generic_yuv444_to_gray8_line_stripe(src_row_base, &src_order,
+                                                        dst_row_base, width);
+            src_row_base += src_stride;
+            dst_row_base += dst_stride;
+        }
+    }
+
+    return result;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_yuv422_to_gray8(const pixctrl_yuv_order_t src_order,
+                                                                    uint8_t *src, uint8_t *dst,
+                                                                    int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *src_row_base = src, *dst_row_base = dst;
+    register int32_t src_stride = width * src_order.bpp, dst_stride = width;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if ((width % 2) == 0)
+        {
+            for (row = 0; row < height; ++row)
+            {
+                pixctrl_generic_yuv422_to_gray8_line_stripe(src_row_base, &src_order,
+                                                            dst_row_base, width);
+                src_row_base += src_stride;
+                dst_row_base += dst_stride;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_planar_to_gray8(uint8_t *src, uint8_t *dst,
+                                                                    int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        /* the 'Y' plane leads every planar/semi-planar layout with a stride of 'width', so it is one bulk copy */
+        if (src != dst)
+        {
+            (void)memcpy(dst, src, (size_t)width * (size_t)height);
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved yuv444 to gray8
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuv444_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_gray8((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 8U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved yuv422 to gray8
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuyv422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_gray8((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yvyu422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_gray8((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_uyvy422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_gray8((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_vyuy422_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_gray8((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 8U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved yuv420 to gray8
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_planar_to_gray8(src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_planar_to_gray8(src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 8U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Planar to gray8
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuv444p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_planar_to_gray8(src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv422p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_planar_to_gray8(src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 8U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_gray8(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_planar_to_gray8(src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 8U);
+
+    return result;
+}
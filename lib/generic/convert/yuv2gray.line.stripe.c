@@ -0,0 +1,85 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Luma Extract Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_yuv_to_gray8_kernel(uint8_t *src, uint8_t *dst, int32_t width,
+                                                       const int32_t bpp, const int32_t iy)
+{
+    register int32_t col;
+    register uint8_t *src_pos = src + iy;
+
+    for(col = 0; col < width; ++col)
+    {
+        dst[col] = *src_pos;
+        src_pos += bpp;
+    }
+}
+
+/********************************************************************************************
+ *  Interleaved to Gray Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_yuv444_to_gray8_line_stripe(uint8_t *src, const pixctrl_yuv_order_t *src_order,
+                                                 uint8_t *dst, int32_t width)
+{
+    register const int32_t s_iy = src_order->iy;
+    register const int32_t src_bpp = src_order->bpp;
+
+    if ((src_bpp == 3) && (s_iy == 0))
+    {
+        pixctrl_generic_yuv_to_gray8_kernel(src, dst, width, 3, 0);
+    }
+    else
+    {
+        pixctrl_generic_yuv_to_gray8_kernel(src, dst, width, src_bpp, s_iy);
+    }
+}
+
+void pixctrl_generic_yuv422_to_gray8_line_stripe(uint8_t *src, const pixctrl_yuv_order_t *src_order,
+                                                 uint8_t *dst, int32_t width)
+{
+    register const int32_t s_iy = src_order->iy;
+    register const int32_t src_bpp = src_order->bpp;
+
+    /* 'Y' sits on the even (yuyv) or odd (uyvy, vyuy) bytes of the macro-pixel */
+    if ((src_bpp == 2) && (s_iy == 0))
+    {
+        pixctrl_generic_yuv_to_gray8_kernel(src, dst, width, 2, 0);
+    }
+    else if ((src_bpp == 2) && (s_iy == 1))
+    {
+        pixctrl_generic_yuv_to_gray8_kernel(src, dst, width, 2, 1);
+    }
+    else
+    {
+        pixctrl_generic_yuv_to_gray8_kernel(src, dst, width, src_bpp, s_iy);
+    }
+}
@@ -0,0 +1,354 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_xrgb(const pixctrl_yuv_order_t src_order,
+                                                                   const pixctrl_rgb_order_t dst_order,
+                                                                   uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *y_src_row_base = src;
+    uint8_t *uv_src_row_base = NULL;
+    uint8_t *dst_row_base = dst;
+    register int32_t y_stride = width;
+    register int32_t uv_stride = width * (src_order.bpp / 2);
+    register int32_t dst_stride = width * dst_order.bpp;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            uv_src_row_base = y_src_row_base + (y_stride * height);
+            for (row = 0; row < height; ++row)
+            {
+                pixctrl_generic_yuv420_to_xrgb_line_stripe(y_src_row_base, uv_src_row_base, &src_order,
+                                                           dst_row_base, &dst_order,
+                                                           width);
+                y_src_row_base += y_stride;
+                dst_row_base += dst_stride;
+                if ((row % 2) != 0)
+                {
+                    uv_src_row_base += uv_stride;
+                }
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_xrgb(const pixctrl_rgb_order_t dst_order,
+                                                                    uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *y_src_row_base = src;
+    uint8_t *u_src_row_base = NULL, *v_src_row_base = NULL;
+    uint8_t *dst_row_base = dst;
+    register int32_t y_stride = width;
+    register int32_t uv_stride = width / 2;
+    register int32_t dst_stride = width * dst_order.bpp;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            u_src_row_base = y_src_row_base + (y_stride * height);
+            v_src_row_base = u_src_row_base + (uv_stride * (height / 2));
+            for (row = 0; row < height; ++row)
+            {
+                pixctrl_generic_yuv420p_to_xrgb_line_stripe(y_src_row_base, u_src_row_base, v_src_row_base,
+                                                            dst_row_base, &dst_order,
+                                                            width);
+                y_src_row_base += y_stride;
+                dst_row_base += dst_stride;
+                if ((row % 2) != 0)
+                {
+                    u_src_row_base += uv_stride;
+                    v_src_row_base += uv_stride;
+                }
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Semi-Planar nv12 to Interleaved rgb
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv12_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Semi-Planar nv21 to Interleaved rgb
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv21_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_xrgb((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                 (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                 src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Planar yuv420 to Interleaved rgb
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuv420p_to_rgb24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGB,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_bgr24(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGR,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_argb(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_abgr(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_rgba(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_yuv420p_to_bgra(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_xrgb((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                  src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 32U);
+
+    return result;
+}
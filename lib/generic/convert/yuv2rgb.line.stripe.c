@@ -0,0 +1,128 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  YUV to RGB Kernel
+ ********************************************************************************************
+ */
+static inline uint8_t pixctrl_generic_yuv_to_rgb_clip(int32_t val)
+{
+    /* negative sums clip to 0 before the shift */
+    register int32_t shifted = (val < 0) ? 0 : (val >> 8);
+
+    return (uint8_t)((shifted > 255) ? 255 : shifted);
+}
+
+static inline void pixctrl_generic_yuv420_to_xrgb_kernel(uint8_t *y_src, uint8_t *u_src, uint8_t *v_src, const int32_t uv_step,
+                                                         uint8_t *dst, const int32_t dst_bpp,
+                                                         const int32_t ir, const int32_t ig, const int32_t ib, const int32_t ia,
+                                                         int32_t width)
+{
+    register int32_t col, uv_pos;
+    register uint8_t *dst_pos = dst;
+
+    for(col = 0; col < width; ++col)
+    {
+        /* Ref) learn.microsoft.com/en-us/windows/win32/medfound/recommended-8-bit-yuv-formats-for-video-rendering
+         *  C = Y - 16, D = U - 128, E = V - 128
+         *  R = clip( ( 298 * C           + 409 * E + 128) >> 8 )
+         *  G = clip( ( 298 * C - 100 * D - 208 * E + 128) >> 8 )
+         *  B = clip( ( 298 * C + 516 * D           + 128) >> 8 )
+         */
+        register int32_t c, d, e;
+
+        uv_pos = (col / 2) * uv_step;
+        c = ((int32_t)y_src[col] - 16) * 298;
+        d = (int32_t)u_src[uv_pos] - 128;
+        e = (int32_t)v_src[uv_pos] - 128;
+
+        dst_pos[ir] = pixctrl_generic_yuv_to_rgb_clip(c + (409 * e) + 128);
+        dst_pos[ig] = pixctrl_generic_yuv_to_rgb_clip(c - (100 * d) - (208 * e) + 128);
+        dst_pos[ib] = pixctrl_generic_yuv_to_rgb_clip(c + (516 * d) + 128);
+        if (dst_bpp == 4)
+        {
+            dst_pos[ia] = 255U;
+        }
+        dst_pos += dst_bpp;
+    }
+}
+
+static void pixctrl_generic_yuv420_to_xrgb_dispatch(uint8_t *y_src, uint8_t *u_src, uint8_t *v_src, const int32_t uv_step,
+                                                    uint8_t *dst, const pixctrl_rgb_order_t *dst_order, int32_t width)
+{
+    register const int32_t ir = dst_order->ir;
+    register const int32_t ig = dst_order->ig;
+    register const int32_t ib = dst_order->ib;
+    register const int32_t ia = dst_order->ia;
+    register const int32_t dst_bpp = dst_order->bpp;
+
+    /* dispatch the known orders to constant-index loops so the compiler can vectorize them */
+    if ((dst_bpp == 4) && (ir == 0) && (ig == 1) && (ib == 2) && (ia == 3))
+    {
+        pixctrl_generic_yuv420_to_xrgb_kernel(y_src, u_src, v_src, uv_step, dst, 4, 0, 1, 2, 3, width);    /* rgba */
+    }
+    else if ((dst_bpp == 4) && (ir == 2) && (ig == 1) && (ib == 0) && (ia == 3))
+    {
+        pixctrl_generic_yuv420_to_xrgb_kernel(y_src, u_src, v_src, uv_step, dst, 4, 2, 1, 0, 3, width);    /* bgra */
+    }
+    else if ((dst_bpp == 3) && (ir == 0) && (ig == 1) && (ib == 2))
+    {
+        pixctrl_generic_yuv420_to_xrgb_kernel(y_src, u_src, v_src, uv_step, dst, 3, 0, 1, 2, 0, width);    /* rgb24 */
+    }
+    else if ((dst_bpp == 3) && (ir == 2) && (ig == 1) && (ib == 0))
+    {
+        pixctrl_generic_yuv420_to_xrgb_kernel(y_src, u_src, v_src, uv_step, dst, 3, 2, 1, 0, 0, width);    /* bgr24 */
+    }
+    else
+    {
+        pixctrl_generic_yuv420_to_xrgb_kernel(y_src, u_src, v_src, uv_step, dst, dst_bpp, ir, ig, ib, ia, width);
+    }
+}
+
+/********************************************************************************************
+ *  Semi-Planar to Interleaved Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_yuv420_to_xrgb_line_stripe(uint8_t *y_src, uint8_t *uv_src, const pixctrl_yuv_order_t *uv_src_order,
+                                                uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                int32_t width)
+{
+    pixctrl_generic_yuv420_to_xrgb_dispatch(y_src, &uv_src[uv_src_order->iu], &uv_src[uv_src_order->iv], uv_src_order->bpp,
+                                            dst, dst_order, width);
+}
+
+/********************************************************************************************
+ *  Planar to Interleaved Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_yuv420p_to_xrgb_line_stripe(uint8_t *y_src, uint8_t *u_src, uint8_t *v_src,
+                                                 uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                                 int32_t width)
+{
+    pixctrl_generic_yuv420_to_xrgb_dispatch(y_src, u_src, v_src, 1, dst, dst_order, width);
+}
@@ -24,13 +24,43 @@
  * SOFTWARE.
  */
 #include <stdlib.h>
+#include <string.h>
 #include "pixctrl.h"
 #include "common/util.h"
+#include "generic/stats/luma_stats.h"
+#include "common/instrument.h"
 
 /********************************************************************************************
  *  Core Function
  ********************************************************************************************
  */
+/* hands the 'Y' plane over and returns where the destination chroma plane(s) start, '*y_dst' is the
+ * destination 'Y' plane when its rows are copied inside the conversion loop and NULL otherwise */
+static inline uint8_t *pixctrl_generic_pass_y_plane(uint8_t *y_src, uint8_t *dst, int32_t width, int32_t height,
+                                                    pixctrl_y_plane_mode_t y_mode, uint8_t **y_dst)
+{
+    register size_t y_len = (size_t)width * (size_t)height;
+    uint8_t *chroma_dst = dst;
+
+    *y_dst = NULL;
+    switch (y_mode)
+    {
+    case PIXCTRL_Y_PLANE_ROW_COPY:
+        *y_dst = dst;
+        chroma_dst = dst + y_len;
+        break;
+    case PIXCTRL_Y_PLANE_COPY:
+        /* both 'Y' planes are 'width' bytes per row, so one bulk copy covers the whole plane */
+        (void)memcpy(dst, y_src, y_len);
+        chroma_dst = dst + y_len;
+        break;
+    default:
+        break;
+    }
+
+    return chroma_dst;
+}
+
 static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_yuv422(const pixctrl_yuv_order_t src_order, 
                                                                      const pixctrl_yuv_order_t dst_order, 
                                                                      uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
@@ -64,7 +94,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_yuv422(const pixct
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_yuv420(const pixctrl_yuv_order_t src_order, 
                                                                      const pixctrl_yuv_order_t dst_order, 
-                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                     pixctrl_luma_stats_t *stats)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *src_row_base = src;
@@ -85,6 +116,10 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_yuv420(const pixct
                 pixctrl_generic_yuv444_to_yuv420_line_stripe(src_row_base, &src_order, 
                                                                          y_dst_row_base, uv_dst_row_base, &dst_order, 
                                                                          width, row);
+                if (stats != NULL)
+                {
+                    pixctrl_generic_luma_stats_line_stripe(y_dst_row_base, row, stats);
+                }
                 src_row_base += src_stride;
                 y_dst_row_base += y_stride;
                 if ((row % 2) != 0)
@@ -135,7 +170,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422_to_yuv444(const pixct
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv422_to_yuv420(const pixctrl_yuv_order_t src_order, 
                                                                      const pixctrl_yuv_order_t dst_order, 
-                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                     pixctrl_luma_stats_t *stats)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *src_row_base = src;
@@ -156,6 +192,10 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422_to_yuv420(const pixct
                 pixctrl_generic_yuv422_to_yuv420_line_stripe(src_row_base, &src_order, 
                                                              y_dst_row_base, uv_dst_row_base, &dst_order, 
                                                              width, row);
+                if (stats != NULL)
+                {
+                    pixctrl_generic_luma_stats_line_stripe(y_dst_row_base, row, stats);
+                }
                 src_row_base += src_stride;
                 y_dst_row_base += y_stride;
                 if ((row % 2) != 0)
@@ -253,6 +293,56 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv422(const pixct
     return result;
 }
 
+static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv420(const pixctrl_yuv_order_t src_order, 
+                                                                     const pixctrl_yuv_order_t dst_order, 
+                                                                     uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                     pixctrl_y_plane_mode_t y_mode)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *y_src_row_base = src;
+    uint8_t *y_dst_row_base = NULL;
+    uint8_t *uv_src_row_base = NULL;
+    uint8_t *uv_dst_row_base = NULL;
+    register int32_t y_stride = width;
+    register int32_t uv_src_stride = width * (src_order.bpp / 2);
+    register int32_t uv_dst_stride = width * (dst_order.bpp / 2);
+    register int32_t row, row_step;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (((width % 2) == 0) && ((height % 2) == 0))
+        {
+            uv_src_row_base = y_src_row_base + (y_stride * height);
+            uv_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
+
+            /* once 'Y' is handed over as a whole, only the chroma rows are left, one per pair of 'Y' rows */
+            row_step = (y_dst_row_base != NULL) ? 1 : 2;
+            for (row = 0; row < height; row += row_step)
+            {
+                pixctrl_generic_yuv420_to_yuv420_line_stripe(y_src_row_base, uv_src_row_base, &src_order, 
+                                                             y_dst_row_base, uv_dst_row_base, &dst_order, 
+                                                             width, row);
+                if (y_dst_row_base != NULL)
+                {
+                    y_src_row_base += y_stride;
+                    y_dst_row_base += y_stride;
+                }
+                if (((row + row_step) % 2) == 0)
+                {
+                    uv_src_row_base += uv_src_stride;
+                    uv_dst_row_base += uv_dst_stride;
+                }
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    return result;
+}
+
 static inline pixctrl_result_t pixctrl_generic_core_yuv444_to_yuv444p(const pixctrl_yuv_order_t src_order,
                                                                       uint8_t *src, uint8_t *dst, 
                                                                       int32_t width, int32_t height)
@@ -506,12 +596,13 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422_to_yuv420p(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv444p(const pixctrl_yuv_order_t src_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
-    uint8_t *uv_src_row_base = NULL;
     uint8_t *y_dst_row_base = NULL;
+    uint8_t *uv_src_row_base = NULL;
     uint8_t *u_dst_row_base = NULL;
     uint8_t *v_dst_row_base = NULL;
     register int32_t yuv_stride = width;
@@ -524,8 +615,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv444p(const pixc
             y_src_row_base = src;
             uv_src_row_base = y_src_row_base + (yuv_stride * height);
 
-            y_dst_row_base = dst;
-            u_dst_row_base = y_dst_row_base + (yuv_stride * height);
+            u_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
             v_dst_row_base = u_dst_row_base + (yuv_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -535,12 +625,15 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv444p(const pixc
                                                               width);
 
                 y_src_row_base += yuv_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += yuv_stride;
+                }
                 if((row % 2) != 0)
                 {
                     uv_src_row_base += yuv_stride;
                 }
 
-                y_dst_row_base += yuv_stride;
                 u_dst_row_base += yuv_stride;
                 v_dst_row_base += yuv_stride;
             }
@@ -556,16 +649,16 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv444p(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv422p(const pixctrl_yuv_order_t src_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
-    uint8_t *uv_src_row_base = NULL;
     uint8_t *y_dst_row_base = NULL;
+    uint8_t *uv_src_row_base = NULL;
     uint8_t *u_dst_row_base = NULL;
     uint8_t *v_dst_row_base = NULL;
     register int32_t yuv_stride = width;
-    register int32_t y_stride = width;
     register int32_t uv_stride = width >> 1;    /* == (width / 2) */
     register int32_t row;
 
@@ -576,8 +669,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv422p(const pixc
             y_src_row_base = src;
             uv_src_row_base = y_src_row_base + (yuv_stride * height);
 
-            y_dst_row_base = dst;
-            u_dst_row_base = y_dst_row_base + (y_stride * height);
+            u_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
             v_dst_row_base = u_dst_row_base + (uv_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -587,12 +679,15 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv422p(const pixc
                                                               width);
 
                 y_src_row_base += yuv_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += yuv_stride;
+                }
                 if((row % 2) != 0)
                 {
                     uv_src_row_base += yuv_stride;
                 }
 
-                y_dst_row_base += y_stride;
                 u_dst_row_base += uv_stride;
                 v_dst_row_base += uv_stride;
             }
@@ -608,16 +703,16 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv422p(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv420p(const pixctrl_yuv_order_t src_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
-    uint8_t *uv_src_row_base = NULL;
     uint8_t *y_dst_row_base = NULL;
+    uint8_t *uv_src_row_base = NULL;
     uint8_t *u_dst_row_base = NULL;
     uint8_t *v_dst_row_base = NULL;
     register int32_t yuv_stride = width;
-    register int32_t y_stride = width;
     register int32_t uv_stride = width >> 1;    /* == (width / 2) */
     register int32_t row;
 
@@ -628,8 +723,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv420p(const pixc
             y_src_row_base = src;
             uv_src_row_base = y_src_row_base + (yuv_stride * height);
 
-            y_dst_row_base = dst;
-            u_dst_row_base = y_dst_row_base + (y_stride * height);
+            u_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
             v_dst_row_base = u_dst_row_base + (uv_stride * (height / 2));
 
             for (row = 0; row < height; ++row)
@@ -639,7 +733,10 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420_to_yuv420p(const pixc
                                                               width, row);
 
                 y_src_row_base += yuv_stride;
-                y_dst_row_base += y_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += yuv_stride;
+                }
                 if((row % 2) != 0)
                 {
                     uv_src_row_base += yuv_stride;
@@ -738,16 +835,17 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420(const pixctrl_yuv_order_t dst_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_luma_stats_t *stats,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
+    uint8_t *y_dst_row_base = NULL;
     uint8_t *u_src_row_base = NULL;
     uint8_t *v_src_row_base = NULL;
-    uint8_t *y_dst_row_base = NULL;
     uint8_t *uv_dst_row_base = NULL;
     register int32_t src_stride = width;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width * (dst_order.bpp / 2);
     register int32_t row;
 
@@ -759,20 +857,26 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420(const pixc
             u_src_row_base = y_src_row_base + (src_stride * height);
             v_src_row_base = u_src_row_base + (src_stride * height);
 
-            y_dst_row_base = dst;
-            uv_dst_row_base = y_dst_row_base + (y_dst_stride * height);
+            uv_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
 
             for (row = 0; row < height; ++row)
             {
                 pixctrl_generic_yuv444p_to_yuv420_line_stripe(y_src_row_base, u_src_row_base, v_src_row_base,
                                                             y_dst_row_base, uv_dst_row_base, &dst_order,
                                                             width, row);
+                if (stats != NULL)
+                {
+                    pixctrl_generic_luma_stats_line_stripe(y_src_row_base, row, stats);
+                }
 
                 y_src_row_base += src_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += src_stride;
+                }
                 u_src_row_base += src_stride;
                 v_src_row_base += src_stride;
                 
-                y_dst_row_base += y_dst_stride;
                 if ((row % 2) != 0)
                 {
                     uv_dst_row_base += uv_dst_stride;
@@ -878,17 +982,18 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv422(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420(const pixctrl_yuv_order_t dst_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_luma_stats_t *stats,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
+    uint8_t *y_dst_row_base = NULL;
     uint8_t *u_src_row_base = NULL;
     uint8_t *v_src_row_base = NULL;
-    uint8_t *y_dst_row_base = NULL;
     uint8_t *uv_dst_row_base = NULL;
     register int32_t y_src_stride = width;
     register int32_t uv_src_stride = width / 2;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width * (dst_order.bpp / 2);
     register int32_t row;
 
@@ -900,20 +1005,26 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420(const pixc
             u_src_row_base = y_src_row_base + (y_src_stride * height);
             v_src_row_base = u_src_row_base + (uv_src_stride * height);
 
-            y_dst_row_base = dst;
-            uv_dst_row_base = y_dst_row_base + (y_dst_stride * height);
+            uv_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
 
             for (row = 0; row < height; ++row)
             {
                 pixctrl_generic_yuv422p_to_yuv420_line_stripe(y_src_row_base, u_src_row_base, v_src_row_base,
                                                               y_dst_row_base, uv_dst_row_base, &dst_order,
                                                               width, row);
+                if (stats != NULL)
+                {
+                    pixctrl_generic_luma_stats_line_stripe(y_src_row_base, row, stats);
+                }
 
                 y_src_row_base += y_src_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += y_src_stride;
+                }
                 u_src_row_base += uv_src_stride;
                 v_src_row_base += uv_src_stride;
                 
-                y_dst_row_base += y_dst_stride;
                 if ((row % 2) != 0)
                 {
                     uv_dst_row_base += uv_dst_stride;
@@ -1025,17 +1136,18 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422(const pixc
 
 static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv420(const pixctrl_yuv_order_t dst_order,
                                                                       uint8_t *src, uint8_t *dst, 
-                                                                      int32_t width, int32_t height)
+                                                                      int32_t width, int32_t height,
+                                                                      pixctrl_luma_stats_t *stats,
+                                                                      pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     uint8_t *y_src_row_base = NULL;
+    uint8_t *y_dst_row_base = NULL;
     uint8_t *u_src_row_base = NULL;
     uint8_t *v_src_row_base = NULL;
-    uint8_t *y_dst_row_base = NULL;
     uint8_t *uv_dst_row_base = NULL;
     register int32_t y_src_stride = width;
     register int32_t uv_src_stride = width / 2;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width * (dst_order.bpp / 2);
     register int32_t row;
 
@@ -1047,17 +1159,23 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv420(const pixc
             u_src_row_base = y_src_row_base + (y_src_stride * height);
             v_src_row_base = u_src_row_base + (uv_src_stride * (height / 2));
 
-            y_dst_row_base = dst;
-            uv_dst_row_base = y_dst_row_base + (y_dst_stride * height);
+            uv_dst_row_base = pixctrl_generic_pass_y_plane(y_src_row_base, dst, width, height, y_mode, &y_dst_row_base);
 
             for (row = 0; row < height; ++row)
             {
                 pixctrl_generic_yuv422p_to_yuv420_line_stripe(y_src_row_base, u_src_row_base, v_src_row_base,
                                                               y_dst_row_base, uv_dst_row_base, &dst_order,
                                                               width, row);
+                if (stats != NULL)
+                {
+                    pixctrl_generic_luma_stats_line_stripe(y_src_row_base, row, stats);
+                }
 
                 y_src_row_base += y_src_stride;
-                y_dst_row_base += y_dst_stride;
+                if (y_dst_row_base != NULL)
+                {
+                    y_dst_row_base += y_src_stride;
+                }
                 if ((row % 2) != 0)
                 {
                     u_src_row_base += uv_src_stride;
@@ -1076,7 +1194,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv420(const pixc
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1084,7 +1203,6 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *
     uint8_t *y_src, *u_src, *v_src;
     register int32_t yuv_src_stride = width;
     uint8_t *y_dst, *u_dst, *v_dst;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width / 2;
 
     if (result == PIXCTRL_SUCCESS)
@@ -1095,8 +1213,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *
             u_src = y_src + (yuv_src_stride * height);
             v_src = u_src + (yuv_src_stride * height);
 
-            y_dst = dst;
-            u_dst = y_dst + (y_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (uv_dst_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -1106,10 +1223,13 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *
                                                                width);
 
                 y_src += yuv_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += yuv_src_stride;
+                }
                 u_src += yuv_src_stride;
                 v_src += yuv_src_stride;
 
-                y_dst += y_dst_stride;
                 u_dst += uv_dst_stride;
                 v_dst += uv_dst_stride;
             }
@@ -1123,7 +1243,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv422p(uint8_t *
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1131,7 +1252,6 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *
     uint8_t *y_src, *u_src, *v_src;
     register int32_t yuv_src_stride = width;
     uint8_t *y_dst, *u_dst, *v_dst;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width / 2;
 
     if (result == PIXCTRL_SUCCESS)
@@ -1142,8 +1262,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *
             u_src = y_src + (yuv_src_stride * height);
             v_src = u_src + (yuv_src_stride * height);
 
-            y_dst = dst;
-            u_dst = y_dst + (y_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (uv_dst_stride * (height / 2));
 
             for (row = 0; row < height; ++row)
@@ -1153,10 +1272,13 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *
                                                                width, row);
 
                 y_src += yuv_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += yuv_src_stride;
+                }
                 u_src += yuv_src_stride;
                 v_src += yuv_src_stride;
 
-                y_dst += y_dst_stride;
                 if ((row % 2) != 0)
                 {
                     u_dst += uv_dst_stride;
@@ -1173,7 +1295,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv444p_to_yuv420p(uint8_t *
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1192,8 +1315,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv444p(uint8_t *
             u_src = y_src + (y_src_stride * height);
             v_src = u_src + (uv_src_stride * height);
 
-            y_dst = dst;
-            u_dst = y_dst + (yuv_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (yuv_dst_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -1203,10 +1325,13 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv444p(uint8_t *
                                                                width);
 
                 y_src += y_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += y_src_stride;
+                }
                 u_src += uv_src_stride;
                 v_src += uv_src_stride;
 
-                y_dst += yuv_dst_stride;
                 u_dst += yuv_dst_stride;
                 v_dst += yuv_dst_stride;
             }
@@ -1220,7 +1345,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv444p(uint8_t *
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1229,7 +1355,6 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *
     register int32_t y_src_stride = width;
     register int32_t uv_src_stride = width / 2;
     uint8_t *y_dst, *u_dst, *v_dst;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width / 2;
 
     if (result == PIXCTRL_SUCCESS)
@@ -1240,8 +1365,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *
             u_src = y_src + (y_src_stride * height);
             v_src = u_src + (uv_src_stride * height);
 
-            y_dst = dst;
-            u_dst = y_dst + (y_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (uv_dst_stride * (height / 2));
 
             for (row = 0; row < height; ++row)
@@ -1251,10 +1375,13 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *
                                                                width, row);
 
                 y_src += y_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += y_src_stride;
+                }
                 u_src += uv_src_stride;
                 v_src += uv_src_stride;
 
-                y_dst += y_dst_stride;
                 if ((row % 2) != 0)
                 {
                     u_dst += uv_dst_stride;
@@ -1271,7 +1398,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv422p_to_yuv420p(uint8_t *
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1290,8 +1418,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv444p(uint8_t *
             u_src = y_src + (y_src_stride * height);
             v_src = u_src + (uv_src_stride * (height / 2));
 
-            y_dst = dst;
-            u_dst = y_dst + (yuv_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (yuv_dst_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -1301,13 +1428,16 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv444p(uint8_t *
                                                                width);
 
                 y_src += y_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += y_src_stride;
+                }
                 if ((row % 2) != 0)
                 {
                     u_src += uv_src_stride;
                     v_src += uv_src_stride;
                 }
 
-                y_dst += yuv_dst_stride;
                 u_dst += yuv_dst_stride;
                 v_dst += yuv_dst_stride;
             }
@@ -1321,7 +1451,8 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv444p(uint8_t *
     return result;
 }
 
-static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height,
+                                                                       pixctrl_y_plane_mode_t y_mode)
 {
     pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
     register int32_t row;
@@ -1330,7 +1461,6 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *
     register int32_t y_src_stride = width;
     register int32_t uv_src_stride = width / 2;
     uint8_t *y_dst, *u_dst, *v_dst;
-    register int32_t y_dst_stride = width;
     register int32_t uv_dst_stride = width / 2;
 
     if (result == PIXCTRL_SUCCESS)
@@ -1341,8 +1471,7 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *
             u_src = y_src + (y_src_stride * height);
             v_src = u_src + (uv_src_stride * (height / 2));
 
-            y_dst = dst;
-            u_dst = y_dst + (y_dst_stride * height);
+            u_dst = pixctrl_generic_pass_y_plane(y_src, dst, width, height, y_mode, &y_dst);
             v_dst = u_dst + (uv_dst_stride * height);
 
             for (row = 0; row < height; ++row)
@@ -1352,13 +1481,16 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *
                                                                width);
 
                 y_src += y_src_stride;
+                if (y_dst != NULL)
+                {
+                    y_dst += y_src_stride;
+                }
                 if ((row % 2) != 0)
                 {
                     u_src += uv_src_stride;
                     v_src += uv_src_stride;
                 }
 
-                y_dst += y_dst_stride;
                 u_dst += uv_dst_stride;
                 v_dst += uv_dst_stride;
             }
@@ -1378,30 +1510,54 @@ static inline pixctrl_result_t pixctrl_generic_core_yuv420p_to_yuv422p(uint8_t *
  */
 pixctrl_result_t pixctrl_generic_yuv444_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1410,16 +1566,28 @@ pixctrl_result_t pixctrl_generic_yuv444_to_vyuy422(uint8_t *src, uint8_t *dst, i
  */
 pixctrl_result_t pixctrl_generic_yuv444_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1428,30 +1596,54 @@ pixctrl_result_t pixctrl_generic_yuv444_to_nv21(uint8_t *src, uint8_t *dst, int3
  */
 pixctrl_result_t pixctrl_generic_yuyv422_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1460,58 +1652,106 @@ pixctrl_result_t pixctrl_generic_vyuy422_to_yuv444(uint8_t *src, uint8_t *dst, i
  */
 pixctrl_result_t pixctrl_generic_yuyv422_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuyv422_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, NULL);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1520,16 +1760,28 @@ pixctrl_result_t pixctrl_generic_vyuy422_to_nv21(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_nv12_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1538,58 +1790,136 @@ pixctrl_result_t pixctrl_generic_nv21_to_yuv444(uint8_t *src, uint8_t *dst, int3
  */
 pixctrl_result_t pixctrl_generic_nv12_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv12_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv12_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv12_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                 (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                 src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                   src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved yuv420 to Interleaved yuv420
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nv12_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_nv21_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                   (const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                   src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1598,20 +1928,38 @@ pixctrl_result_t pixctrl_generic_nv21_to_vyuy422(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_yuv444_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1620,74 +1968,146 @@ pixctrl_result_t pixctrl_generic_yuv444_to_yuv420p(uint8_t *src, uint8_t *dst, i
  */
 pixctrl_result_t pixctrl_generic_yuyv422_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuyv422_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuyv422_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yvyu422_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_uyvy422_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_vyuy422_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1696,38 +2116,74 @@ pixctrl_result_t pixctrl_generic_vyuy422_to_yuv420p(uint8_t *src, uint8_t *dst,
  */
 pixctrl_result_t pixctrl_generic_nv12_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv444p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv12_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv422p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv12_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_nv21_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420_to_yuv420p((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1736,44 +2192,86 @@ pixctrl_result_t pixctrl_generic_nv21_to_yuv420p(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_yuv444p_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1782,44 +2280,86 @@ pixctrl_result_t pixctrl_generic_yuv444p_to_nv21(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_yuv422p_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1828,44 +2368,86 @@ pixctrl_result_t pixctrl_generic_yuv422p_to_nv21(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_yuv420p_to_yuv444(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv444((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUV444,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_yuyv422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YUYV422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_yvyu422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_YVYU422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_uyvy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_UYVY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_vyuy422(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv422((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_VYUY422,
+                                                    src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_nv12(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV12,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_nv21(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
-                                                  src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv420((const pixctrl_yuv_order_t)INIT_PIXCTRL_ORDER_NV21,
+                                                    src, dst, width, height, NULL, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1874,12 +2456,24 @@ pixctrl_result_t pixctrl_generic_yuv420p_to_nv21(uint8_t *src, uint8_t *dst, int
  */
 pixctrl_result_t pixctrl_generic_yuv444p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv422p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv422p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 16U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv444p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv444p_to_yuv420p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv444p_to_yuv420p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 24U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1888,12 +2482,24 @@ pixctrl_result_t pixctrl_generic_yuv444p_to_yuv420p(uint8_t *src, uint8_t *dst,
  */
 pixctrl_result_t pixctrl_generic_yuv422p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv444p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv444p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv422p_to_yuv420p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv422p_to_yuv420p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv422p_to_yuv420p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 16U, 12U);
+
+    return result;
 }
 
 /********************************************************************************************
@@ -1902,10 +2508,195 @@ pixctrl_result_t pixctrl_generic_yuv422p_to_yuv420p(uint8_t *src, uint8_t *dst,
  */
 pixctrl_result_t pixctrl_generic_yuv420p_to_yuv444p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv444p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv444p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 24U);
+
+    return result;
 }
 
 pixctrl_result_t pixctrl_generic_yuv420p_to_yuv422p(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
 {
-    return pixctrl_generic_core_yuv420p_to_yuv422p(src, dst, width, height);
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_yuv420p_to_yuv422p(src, dst, width, height, PIXCTRL_Y_PLANE_ROW_COPY);
+    PIXCTRL_KERNEL_END(result, width, height, 12U, 16U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  yuv to yuv with 'Y' Plane Passthrough
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuv_to_yuv_y_passthrough(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                          pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                          pixctrl_y_plane_mode_t y_mode)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_result_t result = PIXCTRL_NOT_SUPPORT;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    switch (src_fmt)
+    {
+    case PIXCTRL_FMT_NV12:
+    case PIXCTRL_FMT_NV21:
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            if (src_fmt != dst_fmt)
+            {
+                result = pixctrl_generic_core_yuv420_to_yuv420((src_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                               (dst_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                               src, dst, width, height, y_mode);
+            }
+            break;
+        case PIXCTRL_FMT_YUV444P:
+            result = pixctrl_generic_core_yuv420_to_yuv444p((src_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV422P:
+            result = pixctrl_generic_core_yuv420_to_yuv422p((src_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_yuv420_to_yuv420p((src_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, y_mode);
+            break;
+        default:
+            break;
+        }
+        break;
+    case PIXCTRL_FMT_YUV444P:
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            result = pixctrl_generic_core_yuv444p_to_yuv420((dst_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, NULL, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV422P:
+            result = pixctrl_generic_core_yuv444p_to_yuv422p(src, dst, width, height, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_yuv444p_to_yuv420p(src, dst, width, height, y_mode);
+            break;
+        default:
+            break;
+        }
+        break;
+    case PIXCTRL_FMT_YUV422P:
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            result = pixctrl_generic_core_yuv422p_to_yuv420((dst_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, NULL, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV444P:
+            result = pixctrl_generic_core_yuv422p_to_yuv444p(src, dst, width, height, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_yuv422p_to_yuv420p(src, dst, width, height, y_mode);
+            break;
+        default:
+            break;
+        }
+        break;
+    case PIXCTRL_FMT_YUV420P:
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            result = pixctrl_generic_core_yuv420p_to_yuv420((dst_fmt == PIXCTRL_FMT_NV12) ? nv12 : nv21,
+                                                            src, dst, width, height, NULL, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV444P:
+            result = pixctrl_generic_core_yuv420p_to_yuv444p(src, dst, width, height, y_mode);
+            break;
+        case PIXCTRL_FMT_YUV422P:
+            result = pixctrl_generic_core_yuv420p_to_yuv422p(src, dst, width, height, y_mode);
+            break;
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  yuv to yuv420 with Luma Statistics
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_yuv_to_yuv420_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                               pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                               pixctrl_luma_stats_t *stats)
+{
+    static const pixctrl_yuv_order_t yuv444 = INIT_PIXCTRL_ORDER_YUV444;
+    static const pixctrl_yuv_order_t yuyv = INIT_PIXCTRL_ORDER_YUYV422, yvyu = INIT_PIXCTRL_ORDER_YVYU422;
+    static const pixctrl_yuv_order_t uyvy = INIT_PIXCTRL_ORDER_UYVY422, vyuy = INIT_PIXCTRL_ORDER_VYUY422;
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_yuv_order_t dst_order;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    switch (dst_fmt)
+    {
+    case PIXCTRL_FMT_NV12:
+        dst_order = nv12;
+        break;
+    case PIXCTRL_FMT_NV21:
+        dst_order = nv21;
+        break;
+    default:
+        dst_order = nv12;
+        result = PIXCTRL_NOT_SUPPORT;
+        break;
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        switch (src_fmt)
+        {
+        case PIXCTRL_FMT_YUV444:
+            result = pixctrl_generic_core_yuv444_to_yuv420(yuv444, dst_order, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_YUYV422:
+            result = pixctrl_generic_core_yuv422_to_yuv420(yuyv, dst_order, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_YVYU422:
+            result = pixctrl_generic_core_yuv422_to_yuv420(yvyu, dst_order, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_UYVY422:
+            result = pixctrl_generic_core_yuv422_to_yuv420(uyvy, dst_order, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_VYUY422:
+            result = pixctrl_generic_core_yuv422_to_yuv420(vyuy, dst_order, src, dst, width, height, stats);
+            break;
+        case PIXCTRL_FMT_YUV444P:
+            result = pixctrl_generic_core_yuv444p_to_yuv420(dst_order, src, dst, width, height, stats, PIXCTRL_Y_PLANE_ROW_COPY);
+            break;
+        case PIXCTRL_FMT_YUV422P:
+            result = pixctrl_generic_core_yuv422p_to_yuv420(dst_order, src, dst, width, height, stats, PIXCTRL_Y_PLANE_ROW_COPY);
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_yuv420p_to_yuv420(dst_order, src, dst, width, height, stats, PIXCTRL_Y_PLANE_ROW_COPY);
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    return result;
 }
@@ -26,6 +26,12 @@
 #include <stdint.h>
 #include "pixctrl.h"
 
+/* Line-stripes touching a packed row walk it once, a pixel pair at a time, so every packed byte
+ * is loaded (or stored) exactly once and all planes are handled together. When both sides keep
+ * 'Y' in a plane of its own, the 'Y' copy stays a separate loop since it vectorizes as a block copy,
+ * and is skipped for a NULL 'y_dst' so the caller can pass the whole plane through instead.
+ */
+
 /********************************************************************************************
  *  Interleaved to Interleaved Line-Stripe Function
  ********************************************************************************************
@@ -40,40 +46,29 @@ void pixctrl_generic_yuv444_to_yuv422_line_stripe(uint8_t *src, const pixctrl_yu
     register const int32_t src_bpp = src_order->bpp, dst_bpp = dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *src_pos = NULL;
-    register uint8_t *dst_pos = NULL;
+    register uint8_t *src_pos = src;
+    register uint8_t *dst_pos = dst;
 
     register uint32_t u_val = 0U;
     register uint32_t v_val = 0U;
 
-    /* convert 'Y' */
-    src_pos = src;
-    dst_pos = dst;
-    for (col = 0; col < width; ++col)
+    for (col = 0; col < width; col += 2)
     {
+        /* convert 'Y' */
         dst_pos[d_iy] = src_pos[s_iy];
-        src_pos += src_bpp;
-        dst_pos += dst_bpp;
-    }
+        dst_pos[dst_bpp + d_iy] = src_pos[src_bpp + s_iy];
 
-    /* convert 'CbCr' */
-    src_pos = src;
-    dst_pos = dst;
-    for (col = 0; col < width; col += 2)
-    {
-        u_val = src_pos[s_iu];
-        v_val = src_pos[s_iv];
-        src_pos += src_bpp;
-
-        u_val += src_pos[s_iu];
-        v_val += src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'CbCr' */
+        u_val = (uint32_t)src_pos[s_iu] + (uint32_t)src_pos[src_bpp + s_iu];
+        v_val = (uint32_t)src_pos[s_iv] + (uint32_t)src_pos[src_bpp + s_iv];
 
         u_val = u_val >> 1; /* == (u_val / 2) */
         v_val = v_val >> 1; /* == (v_val / 2) */
 
         dst_pos[d_iu] = (uint8_t)u_val;
         dst_pos[d_iv] = (uint8_t)v_val;
+
+        src_pos += (src_bpp * 2);
         dst_pos += (dst_bpp * 2);
     }
 }
@@ -88,32 +83,21 @@ void pixctrl_generic_yuv444_to_yuv420_line_stripe(uint8_t *src, const pixctrl_yu
     register const int32_t src_bpp = src_order->bpp, uv_dst_bpp = uv_dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *src_pos = NULL;
-    register uint8_t *uv_dst_pos = NULL;
+    register uint8_t *src_pos = src;
+    register uint8_t *uv_dst_pos = uv_dst;
 
     register uint32_t u_val = 0U;
     register uint32_t v_val = 0U;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col] = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
-
-    /* convert 'CbCr' */
-    src_pos = src;
-    uv_dst_pos = uv_dst;
     for(col = 0; col < width; col += 2)
     {
-        u_val = src_pos[s_iu];
-        v_val = src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'Y' */
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
 
-        u_val += src_pos[s_iu];
-        v_val += src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'CbCr' */
+        u_val = (uint32_t)src_pos[s_iu] + (uint32_t)src_pos[src_bpp + s_iu];
+        v_val = (uint32_t)src_pos[s_iv] + (uint32_t)src_pos[src_bpp + s_iv];
 
         u_val = u_val >> 1; /* == (u_val / 2) */
         v_val = v_val >> 1; /* == (v_val / 2) */
@@ -129,6 +113,8 @@ void pixctrl_generic_yuv444_to_yuv420_line_stripe(uint8_t *src, const pixctrl_yu
 
         uv_dst_pos[d_iu] = (uint8_t)u_val;
         uv_dst_pos[d_iv] = (uint8_t)v_val;
+
+        src_pos += (src_bpp * 2);
         uv_dst_pos += uv_dst_bpp;
     }
 }
@@ -143,30 +129,25 @@ void pixctrl_generic_yuv422_to_yuv444_line_stripe(uint8_t *src, const pixctrl_yu
     register const int32_t src_bpp = uv_src_order->bpp, dst_bpp = dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *src_pos = NULL;
-    register uint8_t *dst_pos = NULL;
+    register uint8_t *src_pos = src;
+    register uint8_t *dst_pos = dst;
 
-    /* convert 'Y' */
-    src_pos = src;
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = src_pos[s_iy];
-        src_pos += src_bpp;
-        dst_pos += dst_bpp;
-    }
+    register uint8_t u_val;
+    register uint8_t v_val;
 
-    /* convert 'CbCr' */
-    src_pos = src;
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
-        dst_pos[d_iu] = src_pos[s_iu];
-        dst_pos[d_iv] = src_pos[s_iv];
+        u_val = src_pos[s_iu];
+        v_val = src_pos[s_iv];
+
+        dst_pos[d_iy] = src_pos[s_iy];
+        dst_pos[d_iu] = u_val;
+        dst_pos[d_iv] = v_val;
         dst_pos += dst_bpp;
 
-        dst_pos[d_iu] = src_pos[s_iu];
-        dst_pos[d_iv] = src_pos[s_iv];
+        dst_pos[d_iy] = src_pos[src_bpp + s_iy];
+        dst_pos[d_iu] = u_val;
+        dst_pos[d_iv] = v_val;
         dst_pos += dst_bpp;
 
         src_pos += (src_bpp * 2);
@@ -183,28 +164,21 @@ void pixctrl_generic_yuv422_to_yuv420_line_stripe(uint8_t *src, const pixctrl_yu
     register const int32_t src_bpp = uv_src_order->bpp, uv_dst_bpp = uv_dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *src_pos = NULL;
-    register uint8_t *uv_dst_pos = NULL;
+    register uint8_t *src_pos = src;
+    register uint8_t *uv_dst_pos = uv_dst;
 
     register uint32_t u_val = 0U;
     register uint32_t v_val = 0U;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
+    for(col = 0; col < width; col += 2)
     {
+        /* convert 'Y' */
         y_dst[col] = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
 
-    /* convert 'CbCr' */
-    src_pos = src;
-    uv_dst_pos = uv_dst;
-    for(col = 0; col < width; col += 2)
-    {
+        /* convert 'CbCr' */
         u_val = src_pos[s_iu];
         v_val = src_pos[s_iv];
-        src_pos += (src_bpp * 2);
 
         if ((row % 2) != 0)
         {
@@ -218,6 +192,7 @@ void pixctrl_generic_yuv422_to_yuv420_line_stripe(uint8_t *src, const pixctrl_yu
         uv_dst_pos[d_iu] = (uint8_t)u_val;
         uv_dst_pos[d_iv] = (uint8_t)v_val;
 
+        src_pos += (src_bpp * 2);
         uv_dst_pos += uv_dst_bpp;
     }
 }
@@ -232,28 +207,25 @@ void pixctrl_generic_yuv420_to_yuv444_line_stripe(uint8_t *y_src, uint8_t *uv_sr
     register const int32_t src_bpp = uv_src_order->bpp, dst_bpp = dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *uv_src_pos = NULL;
-    register uint8_t *dst_pos = NULL;
+    register uint8_t *uv_src_pos = uv_src;
+    register uint8_t *dst_pos = dst;
 
-    /* convert 'Y' */
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = y_src[col];
-        dst_pos += dst_bpp;
-    }
+    register uint8_t u_val;
+    register uint8_t v_val;
 
-    /* convert 'CbCr' */
-    uv_src_pos = uv_src;
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
-        dst_pos[d_iu] = uv_src_pos[s_iu];
-        dst_pos[d_iv] = uv_src_pos[s_iv];
+        u_val = uv_src_pos[s_iu];
+        v_val = uv_src_pos[s_iv];
+
+        dst_pos[d_iy] = y_src[col];
+        dst_pos[d_iu] = u_val;
+        dst_pos[d_iv] = v_val;
         dst_pos += dst_bpp;
 
-        dst_pos[d_iu] = uv_src_pos[s_iu];
-        dst_pos[d_iv] = uv_src_pos[s_iv];
+        dst_pos[d_iy] = y_src[col + 1];
+        dst_pos[d_iu] = u_val;
+        dst_pos[d_iv] = v_val;
         dst_pos += dst_bpp;
 
         uv_src_pos += src_bpp;
@@ -270,29 +242,55 @@ void pixctrl_generic_yuv420_to_yuv422_line_stripe(uint8_t *y_src, uint8_t *uv_sr
     register const int32_t uv_src_bpp = uv_src_order->bpp, dst_bpp = uv_dst_order->bpp;
 
     register int32_t col;
-    register uint8_t *uv_src_pos = NULL;
-    register uint8_t *dst_pos = NULL;
-
-    /* convert 'Y' */
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = y_src[col];
-        dst_pos += dst_bpp;
-    }
+    register uint8_t *uv_src_pos = uv_src;
+    register uint8_t *dst_pos = dst;
 
-    /* convert 'CbCr' */
-    uv_src_pos = uv_src;
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
+        dst_pos[d_iy] = y_src[col];
+        dst_pos[dst_bpp + d_iy] = y_src[col + 1];
         dst_pos[d_iu] = uv_src_pos[s_iu];
         dst_pos[d_iv] = uv_src_pos[s_iv];
+
         uv_src_pos += uv_src_bpp;
         dst_pos += (dst_bpp * 2);
     }
 }
 
+void pixctrl_generic_yuv420_to_yuv420_line_stripe(uint8_t *y_src, uint8_t *uv_src, const pixctrl_yuv_order_t *uv_src_order,
+                                                  uint8_t *y_dst, uint8_t *uv_dst, const pixctrl_yuv_order_t *uv_dst_order,
+                                                  int32_t width, int32_t row)
+{
+    register const int32_t s_iu = uv_src_order->iu, d_iu = uv_dst_order->iu;
+    register const int32_t s_iv = uv_src_order->iv, d_iv = uv_dst_order->iv;
+    register const int32_t src_bpp = uv_src_order->bpp, dst_bpp = uv_dst_order->bpp;
+
+    register int32_t col;
+    register uint8_t *uv_src_pos = uv_src;
+    register uint8_t *uv_dst_pos = uv_dst;
+
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
+    {
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
+    }
+
+    /* convert 'CbCr', once per chroma row */
+    if ((row % 2) == 0)
+    {
+        for(col = 0; col < width; col += 2)
+        {
+            uv_dst_pos[d_iu] = uv_src_pos[s_iu];
+            uv_dst_pos[d_iv] = uv_src_pos[s_iv];
+            uv_src_pos += src_bpp;
+            uv_dst_pos += dst_bpp;
+        }
+    }
+}
+
 /********************************************************************************************
  *  Interleaved to Planar Line-Stripe Function
  ********************************************************************************************
@@ -329,37 +327,29 @@ void pixctrl_generic_yuv444_to_yuv422p_line_stripe(uint8_t *src, const pixctrl_y
     register const int32_t src_bpp = src_order->bpp;
 
     register int32_t col, uv_col;
-    register uint8_t *src_pos = NULL;
+    register uint8_t *src_pos = src;
 
     register uint32_t u_val = 0;
     register uint32_t v_val = 0;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col]  = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
-
-    /* convert 'CbCr' */
-    src_pos = src;
     for(col = 0; col < width; col += 2)
     {
-        u_val = src_pos[s_iu];
-        v_val = src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'Y' */
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
 
-        u_val += src_pos[s_iu];
-        v_val += src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'CbCr' */
+        u_val = (uint32_t)src_pos[s_iu] + (uint32_t)src_pos[src_bpp + s_iu];
+        v_val = (uint32_t)src_pos[s_iv] + (uint32_t)src_pos[src_bpp + s_iv];
 
         u_val = u_val >> 1; /* == (u_val / 2) */
-        v_val = v_val >> 1; /* == (u_val / 2) */
+        v_val = v_val >> 1; /* == (v_val / 2) */
 
         uv_col = col / 2;
         u_dst[uv_col] = (uint8_t)u_val;
         v_dst[uv_col] = (uint8_t)v_val;
+
+        src_pos += (src_bpp * 2);
     }
 }
 
@@ -373,33 +363,23 @@ void pixctrl_generic_yuv444_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_y
     register const int32_t src_bpp = src_order->bpp;
 
     register int32_t col, uv_col;
-    register uint8_t *src_pos = NULL;
+    register uint8_t *src_pos = src;
 
     register uint32_t u_val = 0;
     register uint32_t v_val = 0;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col]  = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
-
-    /* convert 'CbCr' */
-    src_pos = src;
     for(col = 0; col < width; col += 2)
     {
-        u_val = src_pos[s_iu];
-        v_val = src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'Y' */
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
 
-        u_val += src_pos[s_iu];
-        v_val += src_pos[s_iv];
-        src_pos += src_bpp;
+        /* convert 'CbCr' */
+        u_val = (uint32_t)src_pos[s_iu] + (uint32_t)src_pos[src_bpp + s_iu];
+        v_val = (uint32_t)src_pos[s_iv] + (uint32_t)src_pos[src_bpp + s_iv];
 
         u_val = u_val >> 1; /* == (u_val / 2) */
-        v_val = v_val >> 1; /* == (u_val / 2) */
+        v_val = v_val >> 1; /* == (v_val / 2) */
 
         uv_col = col / 2;
         if ((row % 2) != 0)
@@ -412,6 +392,8 @@ void pixctrl_generic_yuv444_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_y
         }
         u_dst[uv_col] = (uint8_t)u_val;
         v_dst[uv_col] = (uint8_t)v_val;
+
+        src_pos += (src_bpp * 2);
     }
 }
 
@@ -428,18 +410,11 @@ void pixctrl_generic_yuv422_to_yuv444p_line_stripe(uint8_t *src, const pixctrl_y
     register int32_t col;
     register uint8_t *src_pos = src;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col]  = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
-
-    /* convert 'CbCr' */
-    src_pos = src;
     for(col = 0; col < width; col += 2)
     {
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
+
         u_dst[col] = src_pos[s_iu];
         v_dst[col] = src_pos[s_iv];
 
@@ -460,23 +435,17 @@ void pixctrl_generic_yuv422_to_yuv422p_line_stripe(uint8_t *src, const pixctrl_y
     register const int32_t src_bpp = src_order->bpp;
 
     register int32_t col, uv_col = 0;
-    register uint8_t *src_pos = NULL;
-
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col]  = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
+    register uint8_t *src_pos = src;
 
-    /* convert 'CbCr' */
-    src_pos = src;
     for(col = 0; col < width; col += 2)
     {
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
+
         uv_col = col / 2;
         u_dst[uv_col] = src_pos[s_iu];
         v_dst[uv_col] = src_pos[s_iv];
+
         src_pos += (src_bpp * 2);
     }
 }
@@ -491,23 +460,18 @@ void pixctrl_generic_yuv422_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_y
     register const int32_t src_bpp = src_order->bpp;
 
     register int32_t col, uv_col = 0;
-    register uint8_t *src_pos = NULL;
+    register uint8_t *src_pos = src;
 
     register uint32_t u_val = 0;
     register uint32_t v_val = 0;
 
-    /* convert 'Y' */
-    src_pos = src;
-    for(col = 0; col < width; ++col)
-    {
-        y_dst[col]  = src_pos[s_iy];
-        src_pos += src_bpp;
-    }
-
-    /* convert 'CbCr' */
-    src_pos = src;
     for(col = 0; col < width; col += 2)
     {
+        /* convert 'Y' */
+        y_dst[col] = src_pos[s_iy];
+        y_dst[col + 1] = src_pos[src_bpp + s_iy];
+
+        /* convert 'CbCr' */
         uv_col = col / 2;
 
         u_val = src_pos[s_iu];
@@ -524,6 +488,7 @@ void pixctrl_generic_yuv422_to_yuv420p_line_stripe(uint8_t *src, const pixctrl_y
 
         u_dst[uv_col] = (uint8_t)u_val;
         v_dst[uv_col] = (uint8_t)v_val;
+
         src_pos += (src_bpp * 2);
     }
 }
@@ -540,10 +505,13 @@ void pixctrl_generic_yuv420_to_yuv444p_line_stripe(uint8_t *y_src, uint8_t *uv_s
     register int32_t col;
     register uint8_t *uv_src_pos = NULL;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -571,10 +539,13 @@ void pixctrl_generic_yuv420_to_yuv422p_line_stripe(uint8_t *y_src, uint8_t *uv_s
     register int32_t col, uv_col;
     register uint8_t *uv_src_pos = NULL;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -599,10 +570,13 @@ void pixctrl_generic_yuv420_to_yuv420p_line_stripe(uint8_t *y_src, uint8_t *uv_s
     register int32_t col, uv_col;
     register uint8_t *uv_src_pos = NULL;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -657,23 +631,15 @@ void pixctrl_generic_yuv444p_to_yuv422_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register uint32_t u_val = 0;
     register uint32_t v_val = 0;
 
-    /* convert 'Y' */
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = y_src[col];
-        dst_pos += dst_bpp;
-    }
-
-    /* convert 'CbCr' */
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
-        u_val = (uint32_t)u_src[col];
-        v_val = (uint32_t)v_src[col];
+        /* convert 'Y' */
+        dst_pos[d_iy] = y_src[col];
+        dst_pos[dst_bpp + d_iy] = y_src[col + 1];
 
-        u_val += (uint32_t)u_src[col + 1];
-        v_val += (uint32_t)v_src[col + 1];
+        /* convert 'CbCr' */
+        u_val = (uint32_t)u_src[col] + (uint32_t)u_src[col + 1];
+        v_val = (uint32_t)v_src[col] + (uint32_t)v_src[col + 1];
 
         u_val = u_val >> 1;
         v_val = v_val >> 1;
@@ -698,10 +664,13 @@ void pixctrl_generic_yuv444p_to_yuv420_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register uint32_t u_val = 0;
     register uint32_t v_val = 0;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -776,19 +745,11 @@ void pixctrl_generic_yuv422p_to_yuv422_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register int32_t col, uv_col;
     register uint8_t *dst_pos = dst;
 
-    /* convert 'Y' */
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = y_src[col];
-        dst_pos += dst_bpp;
-    }
-
-    /* convert 'CbCr' */
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
         uv_col = col / 2;
+        dst_pos[d_iy] = y_src[col];
+        dst_pos[dst_bpp + d_iy] = y_src[col + 1];
         dst_pos[d_iu] = u_src[uv_col];
         dst_pos[d_iv] = v_src[uv_col];
         dst_pos += (dst_bpp * 2);
@@ -809,10 +770,13 @@ void pixctrl_generic_yuv422p_to_yuv420_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register uint32_t u_val;
     register uint32_t v_val;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -873,19 +837,11 @@ void pixctrl_generic_yuv420p_to_yuv422_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register int32_t col, uv_col;
     register uint8_t *dst_pos = dst;
 
-    /* convert 'Y' */
-    dst_pos = dst;
-    for(col = 0; col < width; ++col)
-    {
-        dst_pos[d_iy] = y_src[col];
-        dst_pos += dst_bpp;
-    }
-
-    /* convert 'CbCr' */
-    dst_pos = dst;
     for(col = 0; col < width; col += 2)
     {
         uv_col = col / 2;
+        dst_pos[d_iy] = y_src[col];
+        dst_pos[dst_bpp + d_iy] = y_src[col + 1];
         dst_pos[d_iu] = u_src[uv_col];
         dst_pos[d_iv] = v_src[uv_col];
         dst_pos += (dst_bpp * 2);
@@ -903,10 +859,13 @@ void pixctrl_generic_yuv420p_to_yuv420_line_stripe(uint8_t *y_src, uint8_t *u_sr
     register int32_t col, uv_col;
     register uint8_t *uv_dst_pos = uv_dst;
 
-    /* convert 'Y' */
-    for(col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for(col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'CbCr' */
@@ -936,10 +895,13 @@ void pixctrl_generic_yuv444p_to_yuv422p_line_stripe(uint8_t *y_src, uint8_t *u_s
     register uint32_t u_val;
     register uint32_t v_val;
 
-    /* convert 'Y' */
-    for (col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'UV' */
@@ -962,10 +924,13 @@ void pixctrl_generic_yuv444p_to_yuv420p_line_stripe(uint8_t *y_src, uint8_t *u_s
     register uint32_t u_val;
     register uint32_t v_val;
 
-    /* convert 'Y' */
-    for (col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'UV' */
@@ -997,10 +962,19 @@ void pixctrl_generic_yuv422p_to_yuv444p_line_stripe(uint8_t *y_src, uint8_t *u_s
 {
     register int32_t col, uv_col;
 
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
+    {
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
+    }
+
+    /* convert 'UV' */
     for (col = 0; col < width; ++col)
     {
         uv_col = col / 2;
-        y_dst[col] = y_src[col];
         u_dst[col] = u_src[uv_col];
         v_dst[col] = v_src[uv_col];
     }
@@ -1015,10 +989,13 @@ void pixctrl_generic_yuv422p_to_yuv420p_line_stripe(uint8_t *y_src, uint8_t *u_s
     register uint32_t u_val;
     register uint32_t v_val;
 
-    /* convert 'Y' */
-    for (col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
     {
-        y_dst[col] = y_src[col];
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
     }
 
     /* convert 'UV' */
@@ -1048,10 +1025,19 @@ void pixctrl_generic_yuv420p_to_yuv444p_line_stripe(uint8_t *y_src, uint8_t *u_s
 {
     register int32_t col, uv_col;
 
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
+    {
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
+    }
+
+    /* convert 'UV' */
     for (col = 0; col < width; ++col)
     {
         uv_col = col / 2;
-        y_dst[col] = y_src[col];
         u_dst[col] = u_src[uv_col];
         v_dst[col] = v_src[uv_col];
     }
@@ -1063,10 +1049,18 @@ void pixctrl_generic_yuv420p_to_yuv422p_line_stripe(uint8_t *y_src, uint8_t *u_s
 {
     register int32_t col, uv_col;
 
-    for (col = 0; col < width; ++col)
+    /* convert 'Y', unless the plane is passed through as a whole */
+    if (y_dst != NULL)
+    {
+        for (col = 0; col < width; ++col)
+        {
+            y_dst[col] = y_src[col];
+        }
+    }
+
+    /* convert 'UV' */
+    for (uv_col = 0; uv_col < (width / 2); ++uv_col)
     {
-        uv_col = col / 2;
-        y_dst[col] = y_src[col];
         u_dst[uv_col] = u_src[uv_col];
         v_dst[uv_col] = v_src[uv_col];
     }
@@ -0,0 +1,484 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+#define PIXCTRL_DEMOSAIC_RAW_ROWS       (4)     /* rows r - 1 .. r + 2, the green of row r + 1 reads row r + 2 */
+#define PIXCTRL_DEMOSAIC_GREEN_ROWS     (3)     /* rows r - 1 .. r + 1 */
+#define PIXCTRL_DEMOSAIC_PAD            (1)     /* mirrored samples on each side of a cached row */
+
+typedef struct {
+    pixctrl_raw_t raw;
+    pixctrl_demosaic_method_t method;
+    uint8_t *src;
+    size_t src_stride;
+    int32_t width;
+    int32_t height;
+    int32_t red_row;            /* parity of the rows holding red */
+    int32_t red_col;            /* parity of the columns holding red */
+
+    uint16_t *raw_rows;         /* unpacked source rows, indexed by row % PIXCTRL_DEMOSAIC_RAW_ROWS */
+    int32_t raw_index[PIXCTRL_DEMOSAIC_RAW_ROWS];
+    uint16_t *green_rows;       /* full green rows, indexed by row % PIXCTRL_DEMOSAIC_GREEN_ROWS */
+    int32_t green_index[PIXCTRL_DEMOSAIC_GREEN_ROWS];
+} pixctrl_demosaic_window_t;
+
+/********************************************************************************************
+ *  Demosaic Kernel
+ ********************************************************************************************
+ */
+static inline int32_t pixctrl_generic_demosaic_clip(int32_t val, int32_t max)
+{
+    register int32_t clipped = (val < 0) ? 0 : val;
+
+    return (clipped > max) ? max : clipped;
+}
+
+static inline int32_t pixctrl_generic_demosaic_abs(int32_t val)
+{
+    return (val < 0) ? -val : val;
+}
+
+/* 'native_col' is the parity of the red or blue sites of this row, green sits on the other columns */
+static void pixctrl_generic_demosaic_green_line_stripe(const uint16_t *up, const uint16_t *cur, const uint16_t *down,
+                                                       uint16_t *green, int32_t native_col,
+                                                       pixctrl_demosaic_method_t method, int32_t width)
+{
+    register int32_t col, dh, dv, sum;
+
+    for (col = native_col ^ 1; col < width; col += 2)
+    {
+        green[col] = cur[col];
+    }
+
+    if (method == PIXCTRL_DEMOSAIC_EDGE_AWARE)
+    {
+        for (col = native_col; col < width; col += 2)
+        {
+            /* interpolate along the edge, never across it */
+            dh = pixctrl_generic_demosaic_abs((int32_t)cur[col - 1] - (int32_t)cur[col + 1]);
+            dv = pixctrl_generic_demosaic_abs((int32_t)up[col] - (int32_t)down[col]);
+            if (dh < dv)
+            {
+                sum = (int32_t)cur[col - 1] + (int32_t)cur[col + 1];
+                green[col] = (uint16_t)((sum + 1) >> 1);
+            }
+            else if (dv < dh)
+            {
+                sum = (int32_t)up[col] + (int32_t)down[col];
+                green[col] = (uint16_t)((sum + 1) >> 1);
+            }
+            else
+            {
+                sum = (int32_t)cur[col - 1] + (int32_t)cur[col + 1] + (int32_t)up[col] + (int32_t)down[col];
+                green[col] = (uint16_t)((sum + 2) >> 2);
+            }
+        }
+    }
+    else
+    {
+        for (col = native_col; col < width; col += 2)
+        {
+            sum = (int32_t)cur[col - 1] + (int32_t)cur[col + 1] + (int32_t)up[col] + (int32_t)down[col];
+            green[col] = (uint16_t)((sum + 2) >> 2);
+        }
+    }
+}
+
+static inline void pixctrl_generic_demosaic_store(uint16_t *dst, int32_t red, int32_t green, int32_t blue)
+{
+    dst[0] = (uint16_t)red;
+    dst[1] = (uint16_t)green;
+    dst[2] = (uint16_t)blue;
+}
+
+/* 'native' is the red or blue of this row, 'other' the colour of the rows above and below.
+ * 'dst' receives rgb48 samples of the raw bit depth. */
+static void pixctrl_generic_demosaic_rgb_line_stripe(const uint16_t *up, const uint16_t *cur, const uint16_t *down,
+                                                     const uint16_t *g_up, const uint16_t *g_cur, const uint16_t *g_down,
+                                                     int32_t native_col, int32_t native_is_red,
+                                                     pixctrl_demosaic_method_t method, int32_t bits,
+                                                     uint16_t *dst, int32_t width)
+{
+    register const int32_t max = (1 << bits) - 1;
+    register int32_t col, native, other, green, sum;
+
+    /* red or blue sites: the native colour is sampled, the other one sits on the diagonals */
+    for (col = native_col; col < width; col += 2)
+    {
+        green = (int32_t)g_cur[col];
+        native = (int32_t)cur[col];
+        if (method == PIXCTRL_DEMOSAIC_EDGE_AWARE)
+        {
+            sum = ((int32_t)up[col - 1] - (int32_t)g_up[col - 1]) + ((int32_t)up[col + 1] - (int32_t)g_up[col + 1])
+                + ((int32_t)down[col - 1] - (int32_t)g_down[col - 1]) + ((int32_t)down[col + 1] - (int32_t)g_down[col + 1]);
+            other = pixctrl_generic_demosaic_clip(green + (sum / 4), max);
+        }
+        else
+        {
+            sum = (int32_t)up[col - 1] + (int32_t)up[col + 1] + (int32_t)down[col - 1] + (int32_t)down[col + 1];
+            other = (sum + 2) >> 2;
+        }
+
+        pixctrl_generic_demosaic_store(&dst[col * 3],
+                                       (native_is_red != 0) ? native : other, green, (native_is_red != 0) ? other : native);
+    }
+
+    /* green sites: the native colour sits left and right, the other one above and below */
+    for (col = native_col ^ 1; col < width; col += 2)
+    {
+        green = (int32_t)cur[col];
+        if (method == PIXCTRL_DEMOSAIC_EDGE_AWARE)
+        {
+            sum = ((int32_t)cur[col - 1] - (int32_t)g_cur[col - 1]) + ((int32_t)cur[col + 1] - (int32_t)g_cur[col + 1]);
+            native = pixctrl_generic_demosaic_clip(green + (sum / 2), max);
+            sum = ((int32_t)up[col] - (int32_t)g_up[col]) + ((int32_t)down[col] - (int32_t)g_down[col]);
+            other = pixctrl_generic_demosaic_clip(green + (sum / 2), max);
+        }
+        else
+        {
+            native = ((int32_t)cur[col - 1] + (int32_t)cur[col + 1] + 1) >> 1;
+            other = ((int32_t)up[col] + (int32_t)down[col] + 1) >> 1;
+        }
+
+        pixctrl_generic_demosaic_store(&dst[col * 3],
+                                       (native_is_red != 0) ? native : other, green, (native_is_red != 0) ? other : native);
+    }
+}
+
+/********************************************************************************************
+ *  Row Window
+ ********************************************************************************************
+ */
+static inline int32_t pixctrl_generic_demosaic_reflect(int32_t index, int32_t len)
+{
+    register int32_t reflected = (index < 0) ? -index : index;
+
+    /* mirror around the edge sample, which keeps the bayer parity */
+    return (reflected < len) ? reflected : (((2 * len) - 2) - reflected);
+}
+
+static inline void pixctrl_generic_demosaic_pad(uint16_t *row, int32_t width)
+{
+    row[-1] = row[1];
+    row[width] = row[width - 2];
+}
+
+static uint16_t *pixctrl_generic_demosaic_raw_row(pixctrl_demosaic_window_t *window, int32_t row)
+{
+    const int32_t src_row = pixctrl_generic_demosaic_reflect(row, window->height);
+    const int32_t slot = src_row % PIXCTRL_DEMOSAIC_RAW_ROWS;
+    uint16_t *line = window->raw_rows + ((size_t)slot * (size_t)(window->width + (2 * PIXCTRL_DEMOSAIC_PAD))) + PIXCTRL_DEMOSAIC_PAD;
+    uint8_t *src = window->src + ((size_t)src_row * window->src_stride);
+
+    if (window->raw_index[slot] != src_row)
+    {
+        switch (window->raw)
+        {
+        case PIXCTRL_RAW10:
+            pixctrl_generic_raw16_unpack_line_stripe(src, line, window->width, 10);
+            break;
+        case PIXCTRL_RAW12:
+            pixctrl_generic_raw16_unpack_line_stripe(src, line, window->width, 12);
+            break;
+        case PIXCTRL_RAW10_MIPI:
+            pixctrl_generic_raw10_mipi_unpack_line_stripe(src, line, window->width);
+            break;
+        case PIXCTRL_RAW8:
+        default:
+            pixctrl_generic_raw8_unpack_line_stripe(src, line, window->width);
+            break;
+        }
+        pixctrl_generic_demosaic_pad(line, window->width);
+        window->raw_index[slot] = src_row;
+    }
+
+    return line;
+}
+
+static inline int32_t pixctrl_generic_demosaic_native_col(const pixctrl_demosaic_window_t *window, int32_t row)
+{
+    /* red rows hold red on 'red_col', blue rows hold blue on the other parity */
+    return ((row % 2) == window->red_row) ? window->red_col : (window->red_col ^ 1);
+}
+
+static uint16_t *pixctrl_generic_demosaic_green_row(pixctrl_demosaic_window_t *window, int32_t row)
+{
+    const int32_t src_row = pixctrl_generic_demosaic_reflect(row, window->height);
+    const int32_t slot = src_row % PIXCTRL_DEMOSAIC_GREEN_ROWS;
+    uint16_t *line = window->green_rows + ((size_t)slot * (size_t)(window->width + (2 * PIXCTRL_DEMOSAIC_PAD))) + PIXCTRL_DEMOSAIC_PAD;
+    uint16_t *up, *cur, *down;
+
+    if (window->green_index[slot] != src_row)
+    {
+        up = pixctrl_generic_demosaic_raw_row(window, src_row - 1);
+        cur = pixctrl_generic_demosaic_raw_row(window, src_row);
+        down = pixctrl_generic_demosaic_raw_row(window, src_row + 1);
+        pixctrl_generic_demosaic_green_line_stripe(up, cur, down, line,
+                                                   pixctrl_generic_demosaic_native_col(window, src_row),
+                                                   window->method, window->width);
+        pixctrl_generic_demosaic_pad(line, window->width);
+        window->green_index[slot] = src_row;
+    }
+
+    return line;
+}
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static pixctrl_result_t pixctrl_generic_core_demosaic(pixctrl_demosaic_window_t *window, int32_t bits,
+                                                      const pixctrl_isp_t *isp,
+                                                      pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    static const pixctrl_rgb_order_t rgb = INIT_PIXCTRL_ORDER_RGB;
+    const int32_t width = window->width, height = window->height;
+    const size_t y_len = (size_t)width * (size_t)height;
+    const size_t row_len = (size_t)(width + (2 * PIXCTRL_DEMOSAIC_PAD));
+    pixctrl_result_t result;
+    pixctrl_rgb_order_t dst_order;
+    const pixctrl_rgb_order_t *line_order;
+    uint8_t *y_dst_row_base = dst, *uv_dst_row_base = dst + y_len;
+    uint8_t *u_dst_row_base = dst + y_len, *v_dst_row_base = dst + y_len + (y_len / 4U);
+    uint8_t *rgb_line = NULL, *line;
+    uint16_t *g_up, *g_cur, *g_down, *rgb48_line;
+    int32_t row, i;
+
+    result = pixctrl_get_rgb_order(dst_fmt, &dst_order);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        line_order = &dst_order;
+    }
+    else
+    {
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+        case PIXCTRL_FMT_YUV420P:
+        case PIXCTRL_FMT_GRAY8:
+            /* demosaic into one rgb24 row, then hand it to the rgb converters */
+            line_order = &rgb;
+            rgb_line = (uint8_t *)malloc((size_t)width * 3U);
+            result = (rgb_line != NULL) ? PIXCTRL_SUCCESS : PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            break;
+        default:
+            line_order = &rgb;
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        window->raw_rows = (uint16_t *)malloc(((row_len * (PIXCTRL_DEMOSAIC_RAW_ROWS + PIXCTRL_DEMOSAIC_GREEN_ROWS)) + ((size_t)width * 3U))
+                                              * sizeof(uint16_t));
+        if (window->raw_rows != NULL)
+        {
+            window->green_rows = window->raw_rows + (row_len * PIXCTRL_DEMOSAIC_RAW_ROWS);
+            rgb48_line = window->green_rows + (row_len * PIXCTRL_DEMOSAIC_GREEN_ROWS);
+            for (i = 0; i < PIXCTRL_DEMOSAIC_RAW_ROWS; ++i)
+            {
+                window->raw_index[i] = -1;
+            }
+            for (i = 0; i < PIXCTRL_DEMOSAIC_GREEN_ROWS; ++i)
+            {
+                window->green_index[i] = -1;
+            }
+
+            for (row = 0; row < height; ++row)
+            {
+                /* the greens first, they may pull raw rows r - 2 .. r + 2 through the cache */
+                g_up = pixctrl_generic_demosaic_green_row(window, row - 1);
+                g_cur = pixctrl_generic_demosaic_green_row(window, row);
+                g_down = pixctrl_generic_demosaic_green_row(window, row + 1);
+
+                line = (rgb_line != NULL) ? rgb_line : (dst + ((size_t)row * (size_t)width * (size_t)dst_order.bpp));
+                pixctrl_generic_demosaic_rgb_line_stripe(pixctrl_generic_demosaic_raw_row(window, row - 1),
+                                                         pixctrl_generic_demosaic_raw_row(window, row),
+                                                         pixctrl_generic_demosaic_raw_row(window, row + 1),
+                                                         g_up, g_cur, g_down,
+                                                         pixctrl_generic_demosaic_native_col(window, row),
+                                                         ((row % 2) == window->red_row) ? 1 : 0,
+                                                         window->method, bits,
+                                                         rgb48_line, width);
+
+                /* the row is still in L1, finish it to 8-bit right away */
+                if (isp != NULL)
+                {
+                    pixctrl_generic_rgb48_isp_line_stripe(rgb48_line, bits, isp, line, line_order, width);
+                }
+                else
+                {
+                    pixctrl_generic_rgb48_to_xrgb_line_stripe(rgb48_line, bits, line, line_order, width);
+                }
+
+                if (dst_fmt == PIXCTRL_FMT_GRAY8)
+                {
+                    pixctrl_generic_xrgb_to_gray8_line_stripe(line, line_order, y_dst_row_base, width);
+                }
+                else if (dst_fmt == PIXCTRL_FMT_YUV420P)
+                {
+                    pixctrl_generic_xrgb_to_yuv420p_line_stripe(line, line_order,
+                                                                y_dst_row_base, u_dst_row_base, v_dst_row_base,
+                                                                width, row);
+                }
+                else if ((dst_fmt == PIXCTRL_FMT_NV12) || (dst_fmt == PIXCTRL_FMT_NV21))
+                {
+                    pixctrl_generic_xrgb_to_yuv420_line_stripe(line, line_order,
+                                                               y_dst_row_base, uv_dst_row_base,
+                                                               (dst_fmt == PIXCTRL_FMT_NV12) ? &nv12 : &nv21,
+                                                               width, row);
+                }
+                else
+                {
+                    /* rgb was written in place */
+                }
+
+                y_dst_row_base += width;
+                if ((row % 2) != 0)
+                {
+                    uv_dst_row_base += width;
+                    u_dst_row_base += width / 2;
+                    v_dst_row_base += width / 2;
+                }
+            }
+            free(window->raw_rows);
+        }
+        else
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+    }
+
+    free(rgb_line);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  demosaic and isp
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_isp(const pixctrl_isp_t *isp,
+                                     pixctrl_bayer_t pattern, pixctrl_raw_t raw, pixctrl_demosaic_method_t method,
+                                     uint8_t *src, int32_t width, int32_t height,
+                                     pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_demosaic_window_t window;
+    int32_t bits = 8;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        window.raw = raw;
+        window.method = method;
+        window.src = src;
+        window.width = width;
+        window.height = height;
+
+        switch (raw)
+        {
+        case PIXCTRL_RAW8:
+            window.src_stride = (size_t)width;
+            break;
+        case PIXCTRL_RAW10:
+            window.src_stride = (size_t)width * 2U;
+            bits = 10;
+            break;
+        case PIXCTRL_RAW12:
+            window.src_stride = (size_t)width * 2U;
+            bits = 12;
+            break;
+        case PIXCTRL_RAW10_MIPI:
+            window.src_stride = ((size_t)width * 5U) / 4U;
+            bits = 10;
+            result = ((width % 4) == 0) ? PIXCTRL_SUCCESS : PIXCTRL_INVALID_RANGE;
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+
+        switch (pattern)
+        {
+        case PIXCTRL_BAYER_RGGB:
+            window.red_row = 0;
+            window.red_col = 0;
+            break;
+        case PIXCTRL_BAYER_BGGR:
+            window.red_row = 1;
+            window.red_col = 1;
+            break;
+        case PIXCTRL_BAYER_GRBG:
+            window.red_row = 0;
+            window.red_col = 1;
+            break;
+        case PIXCTRL_BAYER_GBRG:
+            window.red_row = 1;
+            window.red_col = 0;
+            break;
+        default:
+            result = PIXCTRL_INVALID_ARGUMENT;
+            break;
+        }
+
+        if ((method != PIXCTRL_DEMOSAIC_BILINEAR) && (method != PIXCTRL_DEMOSAIC_EDGE_AWARE))
+        {
+            result = PIXCTRL_INVALID_ARGUMENT;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        /* whole 2x2 cells only, the mirrored borders keep the bayer parity */
+        if (((width % 2) != 0) || ((height % 2) != 0))
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+        else
+        {
+            result = pixctrl_generic_core_demosaic(&window, bits, isp, dst_fmt, dst);
+        }
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_demosaic(pixctrl_bayer_t pattern, pixctrl_raw_t raw, pixctrl_demosaic_method_t method,
+                                          uint8_t *src, int32_t width, int32_t height,
+                                          pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    return pixctrl_generic_isp(NULL, pattern, raw, method, src, width, height, dst_fmt, dst);
+}
@@ -0,0 +1,59 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <math.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Gamma Table
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_isp_gamma_lut(double gamma, int32_t bits, uint8_t *lut)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    const int32_t max = (1 << bits) - 1;
+    double val;
+    int32_t i;
+
+    if (lut == NULL)
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+    else if ((bits < 8) || (16 < bits) || (gamma <= 0.0))
+    {
+        result = PIXCTRL_INVALID_RANGE;
+    }
+    else
+    {
+        for (i = 0; i <= max; ++i)
+        {
+            val = pow((double)i / (double)max, 1.0 / gamma);
+            val = (val * 255.0) + 0.5;
+            lut[i] = (uint8_t)val;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,162 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  RGB48 Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_rgb48_to_xrgb_kernel(uint16_t *src, int32_t shift,
+                                                        uint8_t *dst, const int32_t dst_bpp,
+                                                        const int32_t ir, const int32_t ig, const int32_t ib, const int32_t ia,
+                                                        int32_t width)
+{
+    register const uint32_t round = (shift > 0) ? (1U << (uint32_t)(shift - 1)) : 0U;
+    register int32_t col;
+    register uint32_t r, g, b;
+
+    for (col = 0; col < width; ++col)
+    {
+        r = ((uint32_t)src[(col * 3) + 0] + round) >> (uint32_t)shift;
+        g = ((uint32_t)src[(col * 3) + 1] + round) >> (uint32_t)shift;
+        b = ((uint32_t)src[(col * 3) + 2] + round) >> (uint32_t)shift;
+        dst[(col * dst_bpp) + ir] = (uint8_t)((r > 255U) ? 255U : r);
+        dst[(col * dst_bpp) + ig] = (uint8_t)((g > 255U) ? 255U : g);
+        dst[(col * dst_bpp) + ib] = (uint8_t)((b > 255U) ? 255U : b);
+        if (dst_bpp == 4)
+        {
+            dst[(col * dst_bpp) + ia] = 255U;
+        }
+    }
+}
+
+static inline int32_t pixctrl_generic_isp_apply(const int32_t *matrix, int32_t r, int32_t g, int32_t b, int32_t max)
+{
+    register int32_t acc = (matrix[0] * r) + (matrix[1] * g) + (matrix[2] * b) + (1 << (PIXCTRL_ISP_Q - 1));
+
+    /* negative sums clip to 0 before the shift */
+    acc = (acc < 0) ? 0 : (acc >> PIXCTRL_ISP_Q);
+
+    return (acc > max) ? max : acc;
+}
+
+static inline void pixctrl_generic_rgb48_isp_kernel(uint16_t *src, int32_t bits, const int32_t *matrix, const uint8_t *gamma_lut,
+                                                    uint8_t *dst, const int32_t dst_bpp,
+                                                    const int32_t ir, const int32_t ig, const int32_t ib, const int32_t ia,
+                                                    int32_t width)
+{
+    register const int32_t max = (1 << bits) - 1;
+    register const int32_t shift = bits - 8;
+    register const int32_t round = (shift > 0) ? (1 << (shift - 1)) : 0;
+    register int32_t col, r, g, b, out_r, out_g, out_b;
+
+    for (col = 0; col < width; ++col)
+    {
+        r = (int32_t)src[(col * 3) + 0];
+        g = (int32_t)src[(col * 3) + 1];
+        b = (int32_t)src[(col * 3) + 2];
+        out_r = pixctrl_generic_isp_apply(&matrix[0], r, g, b, max);
+        out_g = pixctrl_generic_isp_apply(&matrix[3], r, g, b, max);
+        out_b = pixctrl_generic_isp_apply(&matrix[6], r, g, b, max);
+
+        if (gamma_lut != NULL)
+        {
+            dst[(col * dst_bpp) + ir] = gamma_lut[out_r];
+            dst[(col * dst_bpp) + ig] = gamma_lut[out_g];
+            dst[(col * dst_bpp) + ib] = gamma_lut[out_b];
+        }
+        else
+        {
+            out_r = (out_r + round) >> shift;
+            out_g = (out_g + round) >> shift;
+            out_b = (out_b + round) >> shift;
+            dst[(col * dst_bpp) + ir] = (uint8_t)((out_r > 255) ? 255 : out_r);
+            dst[(col * dst_bpp) + ig] = (uint8_t)((out_g > 255) ? 255 : out_g);
+            dst[(col * dst_bpp) + ib] = (uint8_t)((out_b > 255) ? 255 : out_b);
+        }
+
+        if (dst_bpp == 4)
+        {
+            dst[(col * dst_bpp) + ia] = 255U;
+        }
+    }
+}
+
+/********************************************************************************************
+ *  RGB48 Line-Stripe Function
+ ********************************************************************************************
+ */
+/* 'src' holds r, g, b samples of 'bits' significant bits */
+void pixctrl_generic_rgb48_to_xrgb_line_stripe(uint16_t *src, int32_t bits,
+                                               uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                               int32_t width)
+{
+    register const int32_t shift = bits - 8;
+
+    /* dispatch the known orders to constant-index loops so the compiler can vectorize them */
+    if ((dst_order->bpp == 3) && (dst_order->ir == 0) && (dst_order->ig == 1) && (dst_order->ib == 2))
+    {
+        pixctrl_generic_rgb48_to_xrgb_kernel(src, shift, dst, 3, 0, 1, 2, 0, width);
+    }
+    else if ((dst_order->bpp == 4) && (dst_order->ir == 2) && (dst_order->ig == 1) && (dst_order->ib == 0) && (dst_order->ia == 3))
+    {
+        pixctrl_generic_rgb48_to_xrgb_kernel(src, shift, dst, 4, 2, 1, 0, 3, width);
+    }
+    else
+    {
+        pixctrl_generic_rgb48_to_xrgb_kernel(src, shift, dst, dst_order->bpp,
+                                             dst_order->ir, dst_order->ig, dst_order->ib, dst_order->ia, width);
+    }
+}
+
+/* white balance, colour correction and gamma in one pass, the gains are folded into the matrix columns */
+void pixctrl_generic_rgb48_isp_line_stripe(uint16_t *src, int32_t bits, const pixctrl_isp_t *isp,
+                                           uint8_t *dst, const pixctrl_rgb_order_t *dst_order,
+                                           int32_t width)
+{
+    int32_t matrix[9];
+    int32_t i;
+
+    for (i = 0; i < 9; ++i)
+    {
+        matrix[i] = ((isp->ccm[i] * isp->wb_gain[i % 3]) + (1 << (PIXCTRL_ISP_Q - 1))) >> PIXCTRL_ISP_Q;
+    }
+
+    if ((dst_order->bpp == 3) && (dst_order->ir == 0) && (dst_order->ig == 1) && (dst_order->ib == 2))
+    {
+        pixctrl_generic_rgb48_isp_kernel(src, bits, matrix, isp->gamma_lut, dst, 3, 0, 1, 2, 0, width);
+    }
+    else if ((dst_order->bpp == 4) && (dst_order->ir == 2) && (dst_order->ig == 1) && (dst_order->ib == 0) && (dst_order->ia == 3))
+    {
+        pixctrl_generic_rgb48_isp_kernel(src, bits, matrix, isp->gamma_lut, dst, 4, 2, 1, 0, 3, width);
+    }
+    else
+    {
+        pixctrl_generic_rgb48_isp_kernel(src, bits, matrix, isp->gamma_lut, dst, dst_order->bpp,
+                                         dst_order->ir, dst_order->ig, dst_order->ib, dst_order->ia, width);
+    }
+}
@@ -0,0 +1,77 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Packed MIPI raw10 to raw10
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_raw10_mipi_to_raw10(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    const size_t src_stride = ((size_t)width * 5U) / 4U;
+    const size_t dst_stride = (size_t)width * 2U;
+    uint8_t *src_row_base = src;
+    uint8_t *dst_row_base = dst;
+    uint16_t *line = NULL;
+    register int32_t row;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if ((width % 4) == 0)
+        {
+            line = (uint16_t *)malloc((size_t)width * sizeof(uint16_t));
+            if (line != NULL)
+            {
+                for (row = 0; row < height; ++row)
+                {
+                    pixctrl_generic_raw10_mipi_unpack_line_stripe(src_row_base, line, width);
+                    pixctrl_generic_raw16_pack_line_stripe(line, dst_row_base, width);
+                    src_row_base += src_stride;
+                    dst_row_base += dst_stride;
+                }
+                free(line);
+            }
+            else
+            {
+                result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+
+    PIXCTRL_KERNEL_END(result, width, height, 10U, 16U);
+
+    return result;
+}
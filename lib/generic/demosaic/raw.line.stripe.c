@@ -0,0 +1,88 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Raw Unpack Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_raw8_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width)
+{
+    register int32_t col;
+
+    for (col = 0; col < width; ++col)
+    {
+        dst[col] = (uint16_t)src[col];
+    }
+}
+
+/* little-endian 16-bit samples, only the low 'bits' are kept */
+void pixctrl_generic_raw16_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width, int32_t bits)
+{
+    register const uint32_t mask = (1U << (uint32_t)bits) - 1U;
+    register int32_t col;
+    register uint32_t val;
+
+    for (col = 0; col < width; ++col)
+    {
+        val = (uint32_t)src[(col * 2) + 0] | ((uint32_t)src[(col * 2) + 1] << 8);
+        dst[col] = (uint16_t)(val & mask);
+    }
+}
+
+/* MIPI CSI-2 RAW10: four bytes hold bits [9:2] of four samples, the fifth byte packs their bits [1:0] from the LSB up */
+void pixctrl_generic_raw10_mipi_unpack_line_stripe(uint8_t *src, uint16_t *dst, int32_t width)
+{
+    register int32_t col;
+    register uint32_t lsb;
+    register uint8_t *src_pos = src;
+
+    for (col = 0; col < width; col += 4)
+    {
+        lsb = (uint32_t)src_pos[4];
+        dst[col + 0] = (uint16_t)(((uint32_t)src_pos[0] << 2) | ((lsb >> 0) & 0x3U));
+        dst[col + 1] = (uint16_t)(((uint32_t)src_pos[1] << 2) | ((lsb >> 2) & 0x3U));
+        dst[col + 2] = (uint16_t)(((uint32_t)src_pos[2] << 2) | ((lsb >> 4) & 0x3U));
+        dst[col + 3] = (uint16_t)(((uint32_t)src_pos[3] << 2) | ((lsb >> 6) & 0x3U));
+        src_pos += 5;
+    }
+}
+
+/********************************************************************************************
+ *  Raw Pack Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_raw16_pack_line_stripe(uint16_t *src, uint8_t *dst, int32_t width)
+{
+    register int32_t col;
+
+    for (col = 0; col < width; ++col)
+    {
+        dst[(col * 2) + 0] = (uint8_t)(src[col] & 0xFFU);
+        dst[(col * 2) + 1] = (uint8_t)(src[col] >> 8);
+    }
+}
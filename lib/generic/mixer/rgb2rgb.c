@@ -0,0 +1,258 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+typedef void (*pixctrl_alpha_line_stripe_t)(uint8_t *src, uint8_t *dst, const pixctrl_rgb_order_t *order, int32_t width);
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static inline pixctrl_result_t pixctrl_generic_core_xrgb32_alpha(pixctrl_alpha_line_stripe_t line_stripe,
+                                                                 const pixctrl_rgb_order_t order,
+                                                                 uint8_t *src, uint8_t *dst,
+                                                                 int32_t width, int32_t height)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    uint8_t *src_row_base = src, *dst_row_base = dst;
+    register int32_t stride = width * order.bpp;
+    register int32_t row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        for (row = 0; row < height; ++row)
+        {
+            line_stripe(src_row_base, dst_row_base, &order, width);
+            src_row_base += stride;
+            dst_row_base += stride;
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  premultiply
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgba_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_premultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_rgba_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_premultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_premultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  unpremultiply
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgba_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_unpremultiply(uint8_t *src, uint8_t *dst, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, src, dst, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_rgba_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_unpremultiply_inplace(uint8_t *buf, int32_t width, int32_t height)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(width, height);
+    result = pixctrl_generic_core_xrgb32_alpha(pixctrl_generic_xrgb32_unpremultiply_line_stripe,
+                                               (const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR, buf, buf, width, height);
+    PIXCTRL_KERNEL_END(result, width, height, 32U, 32U);
+
+    return result;
+}
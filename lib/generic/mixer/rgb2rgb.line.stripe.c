@@ -0,0 +1,178 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Reciprocal Table
+ ********************************************************************************************
+ */
+/* ceil(255 * 2^16 / a), a = 0 maps to 0.
+ * ((c * table[a]) + 2^15) >> 16 equals round(c * 255 / a) for every 0 <= c <= a.
+ */
+static const uint32_t gsc_unpremultiply_reciprocal[256] = {
+    0x00000000U, 0x00FF0000U, 0x007F8000U, 0x00550000U, 0x003FC000U, 0x00330000U, 0x002A8000U, 0x00246DB7U,
+    0x001FE000U, 0x001C5556U, 0x00198000U, 0x00172E8CU, 0x00154000U, 0x00139D8AU, 0x001236DCU, 0x00110000U,
+    0x000FF000U, 0x000F0000U, 0x000E2AABU, 0x000D6BCBU, 0x000CC000U, 0x000C2493U, 0x000B9746U, 0x000B1643U,
+    0x000AA000U, 0x000A3334U, 0x0009CEC5U, 0x000971C8U, 0x00091B6EU, 0x0008CB09U, 0x00088000U, 0x000839CFU,
+    0x0007F800U, 0x0007BA2FU, 0x00078000U, 0x00074925U, 0x00071556U, 0x0006E454U, 0x0006B5E6U, 0x000689D9U,
+    0x00066000U, 0x00063832U, 0x0006124AU, 0x0005EE24U, 0x0005CBA3U, 0x0005AAABU, 0x00058B22U, 0x00056CF0U,
+    0x00055000U, 0x0005343FU, 0x0005199AU, 0x00050000U, 0x0004E763U, 0x0004CFB3U, 0x0004B8E4U, 0x0004A2E9U,
+    0x00048DB7U, 0x00047944U, 0x00046585U, 0x00045271U, 0x00044000U, 0x00042E2AU, 0x00041CE8U, 0x00040C31U,
+    0x0003FC00U, 0x0003EC4FU, 0x0003DD18U, 0x0003CE55U, 0x0003C000U, 0x0003B217U, 0x0003A493U, 0x00039770U,
+    0x00038AABU, 0x00037E40U, 0x0003722AU, 0x00036667U, 0x00035AF3U, 0x00034FCBU, 0x000344EDU, 0x00033A55U,
+    0x00033000U, 0x000325EEU, 0x00031C19U, 0x00031282U, 0x00030925U, 0x00030000U, 0x0002F712U, 0x0002EE59U,
+    0x0002E5D2U, 0x0002DD7CU, 0x0002D556U, 0x0002CD5DU, 0x0002C591U, 0x0002BDF0U, 0x0002B678U, 0x0002AF29U,
+    0x0002A800U, 0x0002A0FEU, 0x00029A20U, 0x00029365U, 0x00028CCDU, 0x00028657U, 0x00028000U, 0x000279CAU,
+    0x000273B2U, 0x00026DB7U, 0x000267DAU, 0x00026218U, 0x00025C72U, 0x000256E7U, 0x00025175U, 0x00024C1CU,
+    0x000246DCU, 0x000241B3U, 0x00023CA2U, 0x000237A7U, 0x000232C3U, 0x00022DF3U, 0x00022939U, 0x00022493U,
+    0x00022000U, 0x00021B82U, 0x00021715U, 0x000212BCU, 0x00020E74U, 0x00020A3EU, 0x00020619U, 0x00020205U,
+    0x0001FE00U, 0x0001FA0CU, 0x0001F628U, 0x0001F253U, 0x0001EE8CU, 0x0001EAD4U, 0x0001E72BU, 0x0001E38FU,
+    0x0001E000U, 0x0001DC80U, 0x0001D90CU, 0x0001D5A4U, 0x0001D24AU, 0x0001CEFBU, 0x0001CBB8U, 0x0001C881U,
+    0x0001C556U, 0x0001C235U, 0x0001BF20U, 0x0001BC15U, 0x0001B915U, 0x0001B61FU, 0x0001B334U, 0x0001B052U,
+    0x0001AD7AU, 0x0001AAABU, 0x0001A7E6U, 0x0001A52AU, 0x0001A277U, 0x00019FCCU, 0x00019D2BU, 0x00019A91U,
+    0x00019800U, 0x00019578U, 0x000192F7U, 0x0001907EU, 0x00018E0DU, 0x00018BA3U, 0x00018941U, 0x000186E6U,
+    0x00018493U, 0x00018246U, 0x00018000U, 0x00017DC2U, 0x00017B89U, 0x00017958U, 0x0001772DU, 0x00017508U,
+    0x000172E9U, 0x000170D1U, 0x00016EBEU, 0x00016CB2U, 0x00016AABU, 0x000168AAU, 0x000166AFU, 0x000164B9U,
+    0x000162C9U, 0x000160DEU, 0x00015EF8U, 0x00015D18U, 0x00015B3CU, 0x00015966U, 0x00015795U, 0x000155C8U,
+    0x00015400U, 0x0001523EU, 0x0001507FU, 0x00014EC5U, 0x00014D10U, 0x00014B5FU, 0x000149B3U, 0x0001480BU,
+    0x00014667U, 0x000144C7U, 0x0001432CU, 0x00014194U, 0x00014000U, 0x00013E71U, 0x00013CE5U, 0x00013B5DU,
+    0x000139D9U, 0x00013859U, 0x000136DCU, 0x00013563U, 0x000133EDU, 0x0001327BU, 0x0001310CU, 0x00012FA1U,
+    0x00012E39U, 0x00012CD5U, 0x00012B74U, 0x00012A16U, 0x000128BBU, 0x00012763U, 0x0001260EU, 0x000124BDU,
+    0x0001236EU, 0x00012223U, 0x000120DAU, 0x00011F94U, 0x00011E51U, 0x00011D11U, 0x00011BD4U, 0x00011A99U,
+    0x00011962U, 0x0001182CU, 0x000116FAU, 0x000115CAU, 0x0001149DU, 0x00011372U, 0x0001124AU, 0x00011124U,
+    0x00011000U, 0x00010EE0U, 0x00010DC1U, 0x00010CA5U, 0x00010B8BU, 0x00010A73U, 0x0001095EU, 0x0001084BU,
+    0x0001073AU, 0x0001062CU, 0x0001051FU, 0x00010415U, 0x0001030DU, 0x00010207U, 0x00010103U, 0x00010000U,
+};
+
+/********************************************************************************************
+ *  Alpha Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_premultiply_kernel(uint8_t *src, uint8_t *dst, int32_t width,
+                                                      const int32_t ia, const int32_t ir, const int32_t ig, const int32_t ib)
+{
+    register int32_t col;
+    register uint8_t *src_pos = src;
+    register uint8_t *dst_pos = dst;
+
+    for(col = 0; col < width; ++col)
+    {
+        /* c * a / 255, rounded, without a division:
+         *  t = c * a + 128, c' = (t + (t >> 8)) >> 8
+         */
+        register uint32_t a = (uint32_t)src_pos[ia];
+        register uint32_t r = ((uint32_t)src_pos[ir] * a) + 128U;
+        register uint32_t g = ((uint32_t)src_pos[ig] * a) + 128U;
+        register uint32_t b = ((uint32_t)src_pos[ib] * a) + 128U;
+
+        dst_pos[ir] = (uint8_t)((r + (r >> 8)) >> 8);
+        dst_pos[ig] = (uint8_t)((g + (g >> 8)) >> 8);
+        dst_pos[ib] = (uint8_t)((b + (b >> 8)) >> 8);
+        dst_pos[ia] = (uint8_t)a;
+        src_pos += 4;
+        dst_pos += 4;
+    }
+}
+
+static inline uint8_t pixctrl_generic_unpremultiply_channel(uint32_t c, uint32_t reciprocal)
+{
+    register uint32_t val = ((c * reciprocal) + 32768U) >> 16;
+
+    /* a colour above its alpha is not a valid premultiplied value, saturate it */
+    return (uint8_t)((val > 255U) ? 255U : val);
+}
+
+static inline void pixctrl_generic_unpremultiply_kernel(uint8_t *src, uint8_t *dst, int32_t width,
+                                                        const int32_t ia, const int32_t ir, const int32_t ig, const int32_t ib)
+{
+    register int32_t col;
+    register uint8_t *src_pos = src;
+    register uint8_t *dst_pos = dst;
+
+    for(col = 0; col < width; ++col)
+    {
+        register uint8_t a = src_pos[ia];
+        register uint32_t reciprocal = gsc_unpremultiply_reciprocal[a];
+
+        dst_pos[ir] = pixctrl_generic_unpremultiply_channel((uint32_t)src_pos[ir], reciprocal);
+        dst_pos[ig] = pixctrl_generic_unpremultiply_channel((uint32_t)src_pos[ig], reciprocal);
+        dst_pos[ib] = pixctrl_generic_unpremultiply_channel((uint32_t)src_pos[ib], reciprocal);
+        dst_pos[ia] = a;
+        src_pos += 4;
+        dst_pos += 4;
+    }
+}
+
+/********************************************************************************************
+ *  Interleaved to Interleaved Line-Stripe Function
+ ********************************************************************************************
+ */
+/* 'src' and 'dst' may be the same buffer: every pixel is read before it is written. */
+void pixctrl_generic_xrgb32_premultiply_line_stripe(uint8_t *src, uint8_t *dst,
+                                                    const pixctrl_rgb_order_t *order, int32_t width)
+{
+    register const int32_t ia = order->ia;
+    register const int32_t ir = order->ir;
+    register const int32_t ig = order->ig;
+    register const int32_t ib = order->ib;
+
+    /* colour channels are treated alike, so only the alpha position picks the loop */
+    if (ia == 3)
+    {
+        pixctrl_generic_premultiply_kernel(src, dst, width, 3, 0, 1, 2);    /* rgba, bgra */
+    }
+    else if (ia == 0)
+    {
+        pixctrl_generic_premultiply_kernel(src, dst, width, 0, 1, 2, 3);    /* argb, abgr */
+    }
+    else
+    {
+        pixctrl_generic_premultiply_kernel(src, dst, width, ia, ir, ig, ib);
+    }
+}
+
+void pixctrl_generic_xrgb32_unpremultiply_line_stripe(uint8_t *src, uint8_t *dst,
+                                                      const pixctrl_rgb_order_t *order, int32_t width)
+{
+    register const int32_t ia = order->ia;
+    register const int32_t ir = order->ir;
+    register const int32_t ig = order->ig;
+    register const int32_t ib = order->ib;
+
+    if (ia == 3)
+    {
+        pixctrl_generic_unpremultiply_kernel(src, dst, width, 3, 0, 1, 2);  /* rgba, bgra */
+    }
+    else if (ia == 0)
+    {
+        pixctrl_generic_unpremultiply_kernel(src, dst, width, 0, 1, 2, 3);  /* argb, abgr */
+    }
+    else
+    {
+        pixctrl_generic_unpremultiply_kernel(src, dst, width, ia, ir, ig, ib);
+    }
+}
@@ -0,0 +1,358 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static pixctrl_result_t pixctrl_generic_core_xrgb32_blend_onto_yuv420(const pixctrl_rgb_order_t src_order,
+                                                                      uint8_t *src, int32_t src_width, int32_t src_height,
+                                                                      pixctrl_alpha_mode_t alpha_mode, pixctrl_fmt_t dst_fmt,
+                                                                      uint8_t *dst, int32_t width, int32_t height,
+                                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    pixctrl_plane_layout_t layout;
+    size_t src_stride = (size_t)src_width * (size_t)src_order.bpp;
+    uint8_t *u_plane, *v_plane, *top, *bottom;
+    uint8_t tail_top[8], tail_bottom[8];
+    int32_t uv_stride, uv_step, uv_width;
+    int32_t x0, x1, y0, y1;
+    register int32_t row, uv_row;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if ((src_width <= 0) || (src_height <= 0))
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+        else if ((alpha_mode != PIXCTRL_ALPHA_STRAIGHT) && (alpha_mode != PIXCTRL_ALPHA_PREMULTIPLIED))
+        {
+            result = PIXCTRL_INVALID_ARGUMENT;
+        }
+        else
+        {
+            result = pixctrl_get_plane_layout(dst_fmt, width, height, &layout);
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        switch (dst_fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+            u_plane = dst + layout.offset[1];
+            v_plane = u_plane + 1;
+            uv_stride = layout.stride[1];
+            uv_step = 2;
+            break;
+        case PIXCTRL_FMT_NV21:
+            v_plane = dst + layout.offset[1];
+            u_plane = v_plane + 1;
+            uv_stride = layout.stride[1];
+            uv_step = 2;
+            break;
+        case PIXCTRL_FMT_YUV420P:
+            u_plane = dst + layout.offset[1];
+            v_plane = dst + layout.offset[2];
+            uv_stride = layout.stride[1];
+            uv_step = 1;
+            break;
+        default:
+            u_plane = NULL;
+            v_plane = NULL;
+            uv_stride = 0;
+            uv_step = 0;
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        /* only the part of the overlay that lands inside the frame is touched */
+        x0 = (x < 0) ? 0 : x;
+        y0 = (y < 0) ? 0 : y;
+        x1 = ((width - x) < src_width) ? width : (x + src_width);
+        y1 = ((height - y) < src_height) ? height : (y + src_height);
+
+        if ((x0 < x1) && (y0 < y1))
+        {
+            for (row = y0; row < y1; ++row)
+            {
+                pixctrl_generic_xrgb32_blend_to_y_line_stripe(src + ((size_t)(row - y) * src_stride) + ((size_t)(x0 - x) * 4U),
+                                                              &src_order, alpha_mode,
+                                                              dst + ((size_t)row * (size_t)width) + (size_t)x0,
+                                                              x1 - x0);
+            }
+
+            /* an odd last column has a chroma block of its own, blended apart below */
+            uv_width = (((width % 2) != 0) && (x1 == width)) ? (x1 - x0 - 1) : (x1 - x0);
+
+            for (uv_row = y0 / 2; (uv_row <= ((y1 - 1) / 2)) && (uv_row < layout.height[1]); ++uv_row)
+            {
+                row = uv_row * 2;
+                top = ((y0 <= row) && (row < y1)) ?
+                      src + ((size_t)(row - y) * src_stride) + ((size_t)(x0 - x) * 4U) : NULL;
+                bottom = ((y0 <= (row + 1)) && ((row + 1) < y1)) ?
+                      src + ((size_t)(row + 1 - y) * src_stride) + ((size_t)(x0 - x) * 4U) : NULL;
+                if ((row + 1) == height)
+                {
+                    /* odd last row: the block holds this row only, as the converters average it */
+                    bottom = top;
+                }
+
+                if (uv_width > 0)
+                {
+                    pixctrl_generic_xrgb32_blend_to_uv_line_stripe(top, bottom, &src_order, alpha_mode, x0 & 1, uv_width,
+                                                                   u_plane + ((size_t)uv_row * (size_t)uv_stride) + ((size_t)(x0 / 2) * (size_t)uv_step),
+                                                                   v_plane + ((size_t)uv_row * (size_t)uv_stride) + ((size_t)(x0 / 2) * (size_t)uv_step),
+                                                                   uv_step);
+                }
+
+                if (uv_width < (x1 - x0))
+                {
+                    /* the last column stands in for the missing one, so the block is blended at full weight */
+                    if (top != NULL)
+                    {
+                        (void)memcpy(&tail_top[0], &top[uv_width * 4], 4U);
+                        (void)memcpy(&tail_top[4], &top[uv_width * 4], 4U);
+                    }
+                    if (bottom != NULL)
+                    {
+                        (void)memcpy(&tail_bottom[0], &bottom[uv_width * 4], 4U);
+                        (void)memcpy(&tail_bottom[4], &bottom[uv_width * 4], 4U);
+                    }
+                    pixctrl_generic_xrgb32_blend_to_uv_line_stripe((top != NULL) ? tail_top : NULL,
+                                                                   (bottom != NULL) ? tail_bottom : NULL,
+                                                                   &src_order, alpha_mode, 0, 2,
+                                                                   u_plane + ((size_t)uv_row * (size_t)uv_stride) + ((size_t)(width / 2) * (size_t)uv_step),
+                                                                   v_plane + ((size_t)uv_row * (size_t)uv_stride) + ((size_t)(width / 2) * (size_t)uv_step),
+                                                                   uv_step);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved rgb onto Semi-Planar nv12
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgba_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV12, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV12, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV12, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_blend_onto_nv12(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV12, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved rgb onto Semi-Planar nv21
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgba_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV21, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV21, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV21, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_blend_onto_nv21(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                      pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                      int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_NV21, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Interleaved rgb onto Planar yuv420
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rgba_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                         pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                         int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_RGBA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_YUV420P, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_bgra_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                         pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                         int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_BGRA,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_YUV420P, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_argb_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                         pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                         int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ARGB,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_YUV420P, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_abgr_blend_onto_yuv420p(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                         pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                         int32_t x, int32_t y)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_KERNEL_BEGIN(src_width, src_height);
+    result = pixctrl_generic_core_xrgb32_blend_onto_yuv420((const pixctrl_rgb_order_t)INIT_PIXCTRL_ORDER_ABGR,
+                                                           src, src_width, src_height, alpha_mode,
+                                                           PIXCTRL_FMT_YUV420P, dst, width, height, x, y);
+    PIXCTRL_KERNEL_END(result, src_width, src_height, 32U, 12U);
+
+    return result;
+}
@@ -0,0 +1,212 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Blend Helper
+ ********************************************************************************************
+ */
+/* rounded x / 255 for 0 <= x <= 255 * 255 */
+static inline uint32_t pixctrl_generic_div255(uint32_t x)
+{
+    register uint32_t t = x + 128U;
+
+    return (t + (t >> 8)) >> 8;
+}
+
+static inline uint8_t pixctrl_generic_clip_u8(int32_t val)
+{
+    return (uint8_t)((val < 0) ? 0 : ((val > 255) ? 255 : val));
+}
+
+/* colour of one overlay pixel, already multiplied by its alpha */
+static inline void pixctrl_generic_overlay_fetch(const uint8_t *pos, const pixctrl_alpha_mode_t alpha_mode,
+                                                 const int32_t ir, const int32_t ig, const int32_t ib, const int32_t ia,
+                                                 uint32_t *a, uint32_t *pr, uint32_t *pg, uint32_t *pb)
+{
+    *a = (uint32_t)pos[ia];
+    if (alpha_mode == PIXCTRL_ALPHA_PREMULTIPLIED)
+    {
+        *pr = (uint32_t)pos[ir];
+        *pg = (uint32_t)pos[ig];
+        *pb = (uint32_t)pos[ib];
+    }
+    else
+    {
+        *pr = pixctrl_generic_div255((uint32_t)pos[ir] * *a);
+        *pg = pixctrl_generic_div255((uint32_t)pos[ig] * *a);
+        *pb = pixctrl_generic_div255((uint32_t)pos[ib] * *a);
+    }
+}
+
+/********************************************************************************************
+ *  Blend Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_blend_y_kernel(uint8_t *src, uint8_t *y_dst, int32_t width,
+                                                  const pixctrl_alpha_mode_t alpha_mode,
+                                                  const int32_t ir, const int32_t ig, const int32_t ib, const int32_t ia)
+{
+    register int32_t col;
+    register uint8_t *src_pos = src;
+
+    for(col = 0; col < width; ++col)
+    {
+        /* Y' = Y * (1 - a) + Yo * a, where Yo * a splits into the linear part over the
+         * premultiplied colour and the +16 offset scaled by alpha.
+         *  Yo * a = ( (  66 * Pr + 129 * Pg +  25 * Pb + 128) >> 8) +  16 * a
+         */
+        uint32_t a, pr, pg, pb;
+        register int32_t y_val;
+
+        pixctrl_generic_overlay_fetch(src_pos, alpha_mode, ir, ig, ib, ia, &a, &pr, &pg, &pb);
+        y_val  = (int32_t)pixctrl_generic_div255(((uint32_t)y_dst[col] * (255U - a)) + (16U * a));
+        y_val += (int32_t)(((66U * pr) + (129U * pg) + (25U * pb) + 128U) >> 8);
+        y_dst[col] = pixctrl_generic_clip_u8(y_val);
+        src_pos += 4;
+    }
+}
+
+static inline void pixctrl_generic_blend_uv_sample(uint8_t *u_pos, uint8_t *v_pos,
+                                                   uint32_t a_sum, uint32_t pr_sum, uint32_t pg_sum, uint32_t pb_sum)
+{
+    /* alpha and premultiplied colour are averaged over the 2x2 block, then
+     *  U' = U * (1 - A) + ( ( -38 * Pr -  74 * Pg + 112 * Pb + 128) >> 8) + 128 * A
+     *  V' = V * (1 - A) + ( ( 112 * Pr -  94 * Pg -  18 * Pb + 128) >> 8) + 128 * A
+     * 32768 keeps the sums positive before the shift and is taken back out afterwards.
+     */
+    register uint32_t a  = (a_sum + 2U) >> 2;
+    register int32_t  pr = (int32_t)((pr_sum + 2U) >> 2);
+    register int32_t  pg = (int32_t)((pg_sum + 2U) >> 2);
+    register int32_t  pb = (int32_t)((pb_sum + 2U) >> 2);
+    register int32_t  val;
+
+    val  = (int32_t)pixctrl_generic_div255(((uint32_t)*u_pos * (255U - a)) + (128U * a));
+    val += (int32_t)((uint32_t)((-38 * pr) + (-74 * pg) + (112 * pb) + 128 + 32768) >> 8) - 128;
+    *u_pos = pixctrl_generic_clip_u8(val);
+
+    val  = (int32_t)pixctrl_generic_div255(((uint32_t)*v_pos * (255U - a)) + (128U * a));
+    val += (int32_t)((uint32_t)((112 * pr) + (-94 * pg) + (-18 * pb) + 128 + 32768) >> 8) - 128;
+    *v_pos = pixctrl_generic_clip_u8(val);
+}
+
+/********************************************************************************************
+ *  Interleaved to Semi-Planar/Planar Blend Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_xrgb32_blend_to_y_line_stripe(uint8_t *src, const pixctrl_rgb_order_t *src_order,
+                                                   pixctrl_alpha_mode_t alpha_mode,
+                                                   uint8_t *y_dst, int32_t width)
+{
+    register const int32_t ir = src_order->ir;
+    register const int32_t ig = src_order->ig;
+    register const int32_t ib = src_order->ib;
+    register const int32_t ia = src_order->ia;
+
+    /* dispatch the known orders to constant-index loops so the compiler can vectorize them */
+    if (alpha_mode == PIXCTRL_ALPHA_PREMULTIPLIED)
+    {
+        if ((ir == 0) && (ig == 1) && (ib == 2) && (ia == 3))
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_PREMULTIPLIED, 0, 1, 2, 3);  /* rgba */
+        }
+        else if ((ir == 2) && (ig == 1) && (ib == 0) && (ia == 3))
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_PREMULTIPLIED, 2, 1, 0, 3);  /* bgra */
+        }
+        else
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_PREMULTIPLIED, ir, ig, ib, ia);
+        }
+    }
+    else
+    {
+        if ((ir == 0) && (ig == 1) && (ib == 2) && (ia == 3))
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_STRAIGHT, 0, 1, 2, 3);       /* rgba */
+        }
+        else if ((ir == 2) && (ig == 1) && (ib == 0) && (ia == 3))
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_STRAIGHT, 2, 1, 0, 3);       /* bgra */
+        }
+        else
+        {
+            pixctrl_generic_blend_y_kernel(src, y_dst, width, PIXCTRL_ALPHA_STRAIGHT, ir, ig, ib, ia);
+        }
+    }
+}
+
+/* 'top' and 'bottom' are the overlay rows covering the chroma row, either may be NULL when the
+ * overlay does not reach it. 'phase' is 1 when the overlay starts on an odd luma column; samples
+ * of the 2x2 block not covered by the overlay count as fully transparent.
+ */
+void pixctrl_generic_xrgb32_blend_to_uv_line_stripe(uint8_t *top, uint8_t *bottom, const pixctrl_rgb_order_t *src_order,
+                                                    pixctrl_alpha_mode_t alpha_mode, int32_t phase, int32_t width,
+                                                    uint8_t *u_dst, uint8_t *v_dst, int32_t uv_step)
+{
+    register const int32_t ir = src_order->ir;
+    register const int32_t ig = src_order->ig;
+    register const int32_t ib = src_order->ib;
+    register const int32_t ia = src_order->ia;
+    register const int32_t blocks = (phase + width + 1) / 2;
+
+    register int32_t block, col, cur;
+    uint32_t a, pr, pg, pb;
+    uint32_t a_sum, pr_sum, pg_sum, pb_sum;
+    uint8_t *rows[2];
+
+    rows[0] = top;
+    rows[1] = bottom;
+
+    for (block = 0; block < blocks; ++block)
+    {
+        a_sum = 0U;
+        pr_sum = 0U;
+        pg_sum = 0U;
+        pb_sum = 0U;
+
+        for (col = (block * 2) - phase; col < ((block * 2) - phase + 2); ++col)
+        {
+            if ((0 <= col) && (col < width))
+            {
+                for (cur = 0; cur < 2; ++cur)
+                {
+                    if (rows[cur] != NULL)
+                    {
+                        pixctrl_generic_overlay_fetch(&rows[cur][col * 4], alpha_mode, ir, ig, ib, ia, &a, &pr, &pg, &pb);
+                        a_sum += a;
+                        pr_sum += pr;
+                        pg_sum += pg;
+                        pb_sum += pb;
+                    }
+                }
+            }
+        }
+
+        pixctrl_generic_blend_uv_sample(&u_dst[block * uv_step], &v_dst[block * uv_step], a_sum, pr_sum, pg_sum, pb_sum);
+    }
+}
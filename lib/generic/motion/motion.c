@@ -0,0 +1,207 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/band.h"
+#include "common/instrument.h"
+
+typedef struct {
+    uint8_t *prev;
+    uint8_t *curr;
+    int32_t width;
+    int32_t height;
+    int32_t blocks_x;
+    uint32_t threshold;
+    uint32_t *sad;
+    uint8_t *dst;
+} pixctrl_motion_job_t;
+
+/********************************************************************************************
+ *  Band Function
+ ********************************************************************************************
+ */
+static void pixctrl_generic_sad_block_row(const pixctrl_motion_job_t *job, int32_t block_row, uint32_t *block_sad)
+{
+    register int32_t row = block_row * PIXCTRL_MOTION_BLOCK;
+    register int32_t row_end = ((row + PIXCTRL_MOTION_BLOCK) < job->height) ? (row + PIXCTRL_MOTION_BLOCK) : job->height;
+    register size_t offset;
+
+    (void)memset(block_sad, 0, (size_t)job->blocks_x * sizeof(uint32_t));
+    for (; row < row_end; ++row)
+    {
+        offset = (size_t)row * (size_t)job->width;
+        pixctrl_generic_sad_line_stripe(job->prev + offset, job->curr + offset, block_sad, job->width);
+    }
+}
+
+static pixctrl_result_t pixctrl_generic_absdiff_band(void *arg, int32_t begin, int32_t end)
+{
+    const pixctrl_motion_job_t *job = (const pixctrl_motion_job_t *)arg;
+    register int32_t row;
+    register size_t offset;
+
+    for (row = begin; row < end; ++row)
+    {
+        offset = (size_t)row * (size_t)job->width;
+        pixctrl_generic_absdiff_line_stripe(job->prev + offset, job->curr + offset, job->dst + offset, job->width);
+    }
+
+    return PIXCTRL_SUCCESS;
+}
+
+static pixctrl_result_t pixctrl_generic_block_sad_band(void *arg, int32_t begin, int32_t end)
+{
+    const pixctrl_motion_job_t *job = (const pixctrl_motion_job_t *)arg;
+    register int32_t block_row;
+
+    for (block_row = begin; block_row < end; ++block_row)
+    {
+        pixctrl_generic_sad_block_row(job, block_row, job->sad + ((size_t)block_row * (size_t)job->blocks_x));
+    }
+
+    return PIXCTRL_SUCCESS;
+}
+
+static pixctrl_result_t pixctrl_generic_motion_map_band(void *arg, int32_t begin, int32_t end)
+{
+    const pixctrl_motion_job_t *job = (const pixctrl_motion_job_t *)arg;
+    uint32_t *block_sad = (uint32_t *)malloc((size_t)job->blocks_x * sizeof(uint32_t));
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    uint8_t *map;
+    register int32_t block_row, block;
+
+    if (block_sad != NULL)
+    {
+        for (block_row = begin; block_row < end; ++block_row)
+        {
+            pixctrl_generic_sad_block_row(job, block_row, block_sad);
+            map = job->dst + ((size_t)block_row * (size_t)job->blocks_x);
+            for (block = 0; block < job->blocks_x; ++block)
+            {
+                map[block] = (block_sad[block] > job->threshold) ? UINT8_MAX : 0U;
+            }
+        }
+        free(block_sad);
+    }
+    else
+    {
+        result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+static pixctrl_result_t pixctrl_generic_core_motion(const char *kernel, pixctrl_band_fn_t fn, int32_t per_block,
+                                                    pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr,
+                                                    int32_t width, int32_t height,
+                                                    uint32_t threshold, uint32_t *sad, uint8_t *dst,
+                                                    int32_t threads)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(prev, curr, width, height);
+    pixctrl_motion_job_t job;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if ((sad != NULL) || (dst != NULL))
+        {
+            /* only the 'Y' plane of yuv frames is compared */
+            result = pixctrl_get_gray8_view(fmt, prev, width, height, &job.prev);
+            if (result == PIXCTRL_SUCCESS)
+            {
+                result = pixctrl_get_gray8_view(fmt, curr, width, height, &job.curr);
+            }
+        }
+        else
+        {
+            result = PIXCTRL_MUST_NOT_BE_NULL;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        job.width = width;
+        job.height = height;
+        job.blocks_x = ((width + PIXCTRL_MOTION_BLOCK) - 1) / PIXCTRL_MOTION_BLOCK;
+        job.threshold = threshold;
+        job.sad = sad;
+        job.dst = dst;
+        result = pixctrl_run_bands(kernel, width, height, fn, &job,
+                                   (per_block != 0) ? (((height + PIXCTRL_MOTION_BLOCK) - 1) / PIXCTRL_MOTION_BLOCK) : height,
+                                   threads);
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Motion
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_absdiff(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                         uint8_t *dst, int32_t threads)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+    result = pixctrl_generic_core_motion(__func__, pixctrl_generic_absdiff_band, 0,
+                                         fmt, prev, curr, width, height, 0U, NULL, dst, threads);
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_block_sad(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                           uint32_t *sad, int32_t threads)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+    result = pixctrl_generic_core_motion(__func__, pixctrl_generic_block_sad_band, 1,
+                                         fmt, prev, curr, width, height, 0U, sad, NULL, threads);
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_motion_map(pixctrl_fmt_t fmt, uint8_t *prev, uint8_t *curr, int32_t width, int32_t height,
+                                            uint32_t threshold, uint8_t *map, int32_t threads)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+    result = pixctrl_generic_core_motion(__func__, pixctrl_generic_motion_map_band, 1,
+                                         fmt, prev, curr, width, height, threshold, NULL, map, threads);
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
@@ -0,0 +1,76 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Motion Line-Stripe
+ ********************************************************************************************
+ */
+void pixctrl_generic_absdiff_line_stripe(uint8_t *src0, uint8_t *src1, uint8_t *dst, int32_t width)
+{
+    register int32_t col;
+    register uint8_t a, b;
+
+    for (col = 0; col < width; ++col)
+    {
+        a = src0[col];
+        b = src1[col];
+        dst[col] = (a > b) ? (uint8_t)(a - b) : (uint8_t)(b - a);
+    }
+}
+
+void pixctrl_generic_sad_line_stripe(uint8_t *src0, uint8_t *src1, uint32_t *block_sad, int32_t width)
+{
+    register int32_t col, block, diff;
+    register int32_t blocks = width / PIXCTRL_MOTION_BLOCK;
+    register uint32_t sad;
+
+    /* a widened |a - b| summed into one accumulator is the pattern the compiler turns into psadbw / vabal */
+    for (block = 0; block < blocks; ++block)
+    {
+        sad = 0U;
+        for (col = 0; col < PIXCTRL_MOTION_BLOCK; ++col)
+        {
+            diff = (int32_t)src0[col] - (int32_t)src1[col];
+            sad += (uint32_t)((diff < 0) ? -diff : diff);
+        }
+        block_sad[block] += sad;
+        src0 += PIXCTRL_MOTION_BLOCK;
+        src1 += PIXCTRL_MOTION_BLOCK;
+    }
+
+    if ((width % PIXCTRL_MOTION_BLOCK) != 0)
+    {
+        sad = 0U;
+        for (col = 0; col < (width % PIXCTRL_MOTION_BLOCK); ++col)
+        {
+            diff = (int32_t)src0[col] - (int32_t)src1[col];
+            sad += (uint32_t)((diff < 0) ? -diff : diff);
+        }
+        block_sad[blocks] += sad;
+    }
+}
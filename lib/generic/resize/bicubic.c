@@ -0,0 +1,64 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pixctrl.h"
+#include "generic/resize/resize.h"
+
+/********************************************************************************************
+ *  Bicubic Weight
+ ********************************************************************************************
+ */
+double pixctrl_generic_bicubic_weight(double x)
+{
+    /* Keys cubic convolution with a = -0.5 */
+    const double a = -0.5;
+    double ax = (x < 0.0) ? -x : x;
+    double weight;
+
+    if (ax < 1.0)
+    {
+        weight = (((a + 2.0) * ax - (a + 3.0)) * ax * ax) + 1.0;
+    }
+    else if (ax < PIXCTRL_BICUBIC_SUPPORT)
+    {
+        weight = (((a * ax - (5.0 * a)) * ax + (8.0 * a)) * ax) - (4.0 * a);
+    }
+    else
+    {
+        weight = 0.0;
+    }
+
+    return weight;
+}
+
+/********************************************************************************************
+ *  bicubic resize
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_bicubic_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                uint8_t *dst, int32_t dst_width, int32_t dst_height)
+{
+    return pixctrl_generic_resize_once(fmt, PIXCTRL_RESIZE_BICUBIC, src, src_width, src_height, dst, dst_width, dst_height);
+}
@@ -0,0 +1,49 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "pixctrl.h"
+#include "generic/resize/resize.h"
+
+/********************************************************************************************
+ *  Bilinear Weight
+ ********************************************************************************************
+ */
+double pixctrl_generic_bilinear_weight(double x)
+{
+    double ax = (x < 0.0) ? -x : x;
+
+    /* triangle filter */
+    return (ax < PIXCTRL_BILINEAR_SUPPORT) ? (1.0 - ax) : 0.0;
+}
+
+/********************************************************************************************
+ *  bilinear resize
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_bilinear_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                 uint8_t *dst, int32_t dst_width, int32_t dst_height)
+{
+    return pixctrl_generic_resize_once(fmt, PIXCTRL_RESIZE_BILINEAR, src, src_width, src_height, dst, dst_width, dst_height);
+}
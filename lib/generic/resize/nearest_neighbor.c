@@ -0,0 +1,102 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <string.h>
+#include "pixctrl.h"
+#include "generic/resize/resize.h"
+
+/********************************************************************************************
+ *  Nearest Neighbor Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_nearest_neighbor_kernel(const int32_t *offset, uint8_t *src, uint8_t *dst,
+                                                           int32_t width, const int32_t channels)
+{
+    register int32_t col, ch;
+    register uint8_t *src_pos;
+    register uint8_t *dst_pos = dst;
+
+    for (col = 0; col < width; ++col)
+    {
+        src_pos = src + ((size_t)offset[col] * (size_t)channels);
+        for (ch = 0; ch < channels; ++ch)
+        {
+            dst_pos[ch] = src_pos[ch];
+        }
+        dst_pos += channels;
+    }
+}
+
+/********************************************************************************************
+ *  Nearest Neighbor Line-Stripe Function
+ ********************************************************************************************
+ */
+void pixctrl_generic_nearest_neighbor_resize_row(const pixctrl_resize_plane_t *plane, uint8_t *src, int32_t row, uint8_t *dst_row)
+{
+    const size_t src_stride = (size_t)plane->src_width * (size_t)plane->channels;
+    uint8_t *src_row = src + ((size_t)plane->v.offset[row] * src_stride);
+
+    switch (plane->channels)
+    {
+    case 1: pixctrl_generic_nearest_neighbor_kernel(plane->h.offset, src_row, dst_row, plane->dst_width, 1); break;
+    case 2: pixctrl_generic_nearest_neighbor_kernel(plane->h.offset, src_row, dst_row, plane->dst_width, 2); break;
+    case 3: pixctrl_generic_nearest_neighbor_kernel(plane->h.offset, src_row, dst_row, plane->dst_width, 3); break;
+    case 4: pixctrl_generic_nearest_neighbor_kernel(plane->h.offset, src_row, dst_row, plane->dst_width, 4); break;
+    default:
+        pixctrl_generic_nearest_neighbor_kernel(plane->h.offset, src_row, dst_row, plane->dst_width, plane->channels);
+        break;
+    }
+}
+
+void pixctrl_generic_nearest_neighbor_resize_plane(const pixctrl_resize_plane_t *plane, uint8_t *src, uint8_t *dst)
+{
+    const size_t dst_stride = (size_t)plane->dst_width * (size_t)plane->channels;
+    uint8_t *dst_row = dst;
+    int32_t row;
+
+    for (row = 0; row < plane->dst_height; ++row)
+    {
+        /* an output row picking the same source row as the previous one is a plain copy */
+        if ((0 < row) && (plane->v.offset[row] == plane->v.offset[row - 1]))
+        {
+            (void)memcpy(dst_row, dst_row - dst_stride, dst_stride);
+        }
+        else
+        {
+            pixctrl_generic_nearest_neighbor_resize_row(plane, src, row, dst_row);
+        }
+        dst_row += dst_stride;
+    }
+}
+
+/********************************************************************************************
+ *  nearest neighbor resize
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_nearest_neighbor_resize(pixctrl_fmt_t fmt, uint8_t *src, int32_t src_width, int32_t src_height,
+                                                         uint8_t *dst, int32_t dst_width, int32_t dst_height)
+{
+    return pixctrl_generic_resize_once(fmt, PIXCTRL_RESIZE_NEAREST_NEIGHBOR, src, src_width, src_height, dst, dst_width, dst_height);
+}
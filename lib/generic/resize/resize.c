@@ -0,0 +1,556 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/instrument.h"
+#include "generic/resize/resize.h"
+
+/********************************************************************************************
+ *  Plane Layout
+ ********************************************************************************************
+ */
+static pixctrl_result_t pixctrl_generic_resize_layout(pixctrl_fmt_t fmt, int32_t width, int32_t height, int32_t *planes,
+                                                      int32_t *plane_width, int32_t *plane_height, int32_t *channels)
+{
+    pixctrl_result_t result;
+    pixctrl_plane_layout_t layout;
+    int32_t i;
+
+    switch (fmt)
+    {
+    case PIXCTRL_FMT_YUYV422:
+    case PIXCTRL_FMT_YVYU422:
+    case PIXCTRL_FMT_UYVY422:
+    case PIXCTRL_FMT_VYUY422:
+        /* packed 4:2:2 shares chroma between pixel pairs and cannot be filtered per sample */
+        result = PIXCTRL_NOT_SUPPORT;
+        break;
+    default:
+        /* odd sizes keep the ceil-sized chroma planes the converters write */
+        result = pixctrl_get_plane_layout(fmt, width, height, &layout);
+        break;
+    }
+
+    *planes = (result == PIXCTRL_SUCCESS) ? layout.planes : 0;
+    for (i = 0; i < *planes; ++i)
+    {
+        plane_width[i] = layout.width[i];
+        plane_height[i] = layout.height[i];
+        channels[i] = layout.stride[i] / layout.width[i];
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Filter Table
+ ********************************************************************************************
+ */
+static inline int32_t pixctrl_generic_floor(double x)
+{
+    int32_t val = (int32_t)x;
+
+    return ((double)val > x) ? (val - 1) : val;
+}
+
+static inline int32_t pixctrl_generic_round(double x)
+{
+    return (x < 0.0) ? (int32_t)(x - 0.5) : (int32_t)(x + 0.5);
+}
+
+static pixctrl_result_t pixctrl_generic_build_filter(pixctrl_resize_filter_t *filter, int32_t src_len, int32_t dst_len,
+                                                     pixctrl_resize_method_t method)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    const double scale = (double)src_len / (double)dst_len;
+    const double filter_scale = (scale > 1.0) ? scale : 1.0;    /* widen the kernel when shrinking */
+    pixctrl_resize_weight_t weight;
+    double support, center, sum, *w;
+    int32_t raw_taps, taps, first, offset, idx, q_sum, q_max;
+    int32_t d, k;
+    int16_t *coeff;
+
+    if (method == PIXCTRL_RESIZE_NEAREST_NEIGHBOR)
+    {
+        filter->taps = 1;
+        filter->coeff = NULL;
+        filter->offset = (int32_t *)malloc(sizeof(int32_t) * (size_t)dst_len);
+        if (filter->offset != NULL)
+        {
+            for (d = 0; d < dst_len; ++d)
+            {
+                /* source sample whose area holds the centre of the output sample */
+                filter->offset[d] = (int32_t)((((int64_t)d * 2 + 1) * src_len) / ((int64_t)dst_len * 2));
+            }
+        }
+        else
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+    }
+    else
+    {
+        if (method == PIXCTRL_RESIZE_BICUBIC)
+        {
+            weight = pixctrl_generic_bicubic_weight;
+            support = PIXCTRL_BICUBIC_SUPPORT * filter_scale;
+        }
+        else
+        {
+            weight = pixctrl_generic_bilinear_weight;
+            support = PIXCTRL_BILINEAR_SUPPORT * filter_scale;
+        }
+
+        raw_taps = pixctrl_generic_floor(support * 2.0);
+        if ((double)raw_taps < (support * 2.0))
+        {
+            ++raw_taps;
+        }
+        /* taps beyond the edge are folded onto it, so a short source needs no more than its length */
+        taps = (raw_taps < src_len) ? raw_taps : src_len;
+
+        filter->taps = taps;
+        filter->offset = (int32_t *)malloc(sizeof(int32_t) * (size_t)dst_len);
+        filter->coeff = (int16_t *)malloc(sizeof(int16_t) * (size_t)dst_len * (size_t)taps);
+        w = (double *)malloc(sizeof(double) * (size_t)taps);
+
+        if ((filter->offset != NULL) && (filter->coeff != NULL) && (w != NULL))
+        {
+            for (d = 0; d < dst_len; ++d)
+            {
+                center = (((double)d + 0.5) * scale) - 0.5;
+                first = pixctrl_generic_floor(center - support) + 1;
+                offset = (first < 0) ? 0 : first;
+                offset = (offset > (src_len - taps)) ? (src_len - taps) : offset;
+
+                for (k = 0; k < taps; ++k)
+                {
+                    w[k] = 0.0;
+                }
+
+                sum = 0.0;
+                for (k = 0; k < raw_taps; ++k)
+                {
+                    double tap_weight = weight(((double)(first + k) - center) / filter_scale);
+
+                    idx = first + k;
+                    idx = (idx < 0) ? 0 : ((idx >= src_len) ? (src_len - 1) : idx);
+                    w[idx - offset] += tap_weight;
+                    sum += tap_weight;
+                }
+
+                /* quantize to Q14 and hand the rounding error to the heaviest tap so unity gain is exact */
+                coeff = &filter->coeff[(size_t)d * (size_t)taps];
+                q_sum = 0;
+                q_max = 0;
+                for (k = 0; k < taps; ++k)
+                {
+                    coeff[k] = (int16_t)pixctrl_generic_round((w[k] / sum) * (double)(1 << PIXCTRL_RESIZE_COEFF_BITS));
+                    q_sum += coeff[k];
+                    q_max = (coeff[k] > coeff[q_max]) ? k : q_max;
+                }
+                coeff[q_max] = (int16_t)(coeff[q_max] + ((1 << PIXCTRL_RESIZE_COEFF_BITS) - q_sum));
+
+                filter->offset[d] = offset;
+            }
+        }
+        else
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+
+        free(w);
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Separable Kernel
+ ********************************************************************************************
+ */
+static inline void pixctrl_generic_resize_h_kernel(const pixctrl_resize_filter_t *h, uint8_t *src, int16_t *dst,
+                                                   int32_t width, const int32_t taps, const int32_t channels)
+{
+    register int32_t col, ch, k;
+    register int32_t acc;
+    const int16_t *coeff = h->coeff;
+    uint8_t *src_pos;
+
+    for (col = 0; col < width; ++col)
+    {
+        src_pos = src + ((size_t)h->offset[col] * (size_t)channels);
+        for (ch = 0; ch < channels; ++ch)
+        {
+            acc = 0;
+            for (k = 0; k < taps; ++k)
+            {
+                acc += (int32_t)coeff[k] * (int32_t)src_pos[(k * channels) + ch];
+            }
+            /* Q14 -> Q6 with rounding, the bias keeps the shifted value positive */
+            acc = ((acc + (1 << 7) + (1 << 24)) >> 8) - (1 << 16);
+            dst[(col * channels) + ch] = (int16_t)acc;
+        }
+        coeff += taps;
+    }
+}
+
+static void pixctrl_generic_resize_h_line_stripe(const pixctrl_resize_filter_t *h, uint8_t *src, int16_t *dst,
+                                                 int32_t width, int32_t channels)
+{
+    /* dispatch the common tap counts to fixed-length loops the compiler can unroll */
+    switch ((h->taps == 2) ? channels : ((h->taps == 4) ? (channels + 4) : 0))
+    {
+    case 1: pixctrl_generic_resize_h_kernel(h, src, dst, width, 2, 1); break;
+    case 2: pixctrl_generic_resize_h_kernel(h, src, dst, width, 2, 2); break;
+    case 3: pixctrl_generic_resize_h_kernel(h, src, dst, width, 2, 3); break;
+    case 4: pixctrl_generic_resize_h_kernel(h, src, dst, width, 2, 4); break;
+    case 5: pixctrl_generic_resize_h_kernel(h, src, dst, width, 4, 1); break;
+    case 6: pixctrl_generic_resize_h_kernel(h, src, dst, width, 4, 2); break;
+    case 7: pixctrl_generic_resize_h_kernel(h, src, dst, width, 4, 3); break;
+    case 8: pixctrl_generic_resize_h_kernel(h, src, dst, width, 4, 4); break;
+    default:
+        pixctrl_generic_resize_h_kernel(h, src, dst, width, h->taps, channels);
+        break;
+    }
+}
+
+static inline uint8_t pixctrl_generic_resize_v_output(int32_t acc)
+{
+    /* Q14 x Q6 -> integer with rounding, clamped to 8-bit */
+    acc += 1 << ((PIXCTRL_RESIZE_COEFF_BITS + PIXCTRL_RESIZE_INTER_BITS) - 1);
+    acc = (acc < 0) ? 0 : (acc >> (PIXCTRL_RESIZE_COEFF_BITS + PIXCTRL_RESIZE_INTER_BITS));
+
+    return (uint8_t)((acc > 255) ? 255 : acc);
+}
+
+static inline void pixctrl_generic_resize_v2_kernel(int16_t **rows, const int16_t *coeff, uint8_t *dst, int32_t len)
+{
+    /* rows and coefficients are held in locals: 'dst' is a byte pointer and may alias them otherwise */
+    const int16_t *row0 = rows[0], *row1 = rows[1];
+    const int32_t c0 = coeff[0], c1 = coeff[1];
+    register int32_t col;
+
+    for (col = 0; col < len; ++col)
+    {
+        dst[col] = pixctrl_generic_resize_v_output((c0 * row0[col]) + (c1 * row1[col]));
+    }
+}
+
+static inline void pixctrl_generic_resize_v4_kernel(int16_t **rows, const int16_t *coeff, uint8_t *dst, int32_t len)
+{
+    const int16_t *row0 = rows[0], *row1 = rows[1], *row2 = rows[2], *row3 = rows[3];
+    const int32_t c0 = coeff[0], c1 = coeff[1], c2 = coeff[2], c3 = coeff[3];
+    register int32_t col;
+
+    for (col = 0; col < len; ++col)
+    {
+        dst[col] = pixctrl_generic_resize_v_output((c0 * row0[col]) + (c1 * row1[col]) + (c2 * row2[col]) + (c3 * row3[col]));
+    }
+}
+
+static inline void pixctrl_generic_resize_vn_kernel(int16_t **rows, const int16_t *coeff, uint8_t *dst, int32_t len, int32_t taps)
+{
+    register int32_t col, k;
+    register int32_t acc;
+
+    for (col = 0; col < len; ++col)
+    {
+        acc = 0;
+        for (k = 0; k < taps; ++k)
+        {
+            acc += (int32_t)coeff[k] * (int32_t)rows[k][col];
+        }
+        dst[col] = pixctrl_generic_resize_v_output(acc);
+    }
+}
+
+static void pixctrl_generic_resize_v_line_stripe(int16_t **rows, const int16_t *coeff, uint8_t *dst,
+                                                 int32_t len, int32_t taps)
+{
+    switch (taps)
+    {
+    case 2: pixctrl_generic_resize_v2_kernel(rows, coeff, dst, len); break;
+    case 4: pixctrl_generic_resize_v4_kernel(rows, coeff, dst, len); break;
+    default:
+        pixctrl_generic_resize_vn_kernel(rows, coeff, dst, len, taps);
+        break;
+    }
+}
+
+void pixctrl_generic_separable_resize_row(pixctrl_resize_plane_t *plane, uint8_t *src, int32_t row, uint8_t *dst_row)
+{
+    const int32_t taps = plane->v.taps;
+    const size_t src_stride = (size_t)plane->src_width * (size_t)plane->channels;
+    const size_t dst_stride = (size_t)plane->dst_width * (size_t)plane->channels;
+    int32_t k, src_row, slot;
+
+    /* each source row is scaled horizontally once and reused by every output row that needs it */
+    for (k = 0; k < taps; ++k)
+    {
+        src_row = plane->v.offset[row] + k;
+        slot = src_row % taps;
+        if (plane->row_index[slot] != src_row)
+        {
+            pixctrl_generic_resize_h_line_stripe(&plane->h, src + ((size_t)src_row * src_stride),
+                                                 &plane->rows[(size_t)slot * dst_stride],
+                                                 plane->dst_width, plane->channels);
+            plane->row_index[slot] = src_row;
+        }
+        plane->row_ptr[k] = &plane->rows[(size_t)slot * dst_stride];
+    }
+
+    pixctrl_generic_resize_v_line_stripe(plane->row_ptr, &plane->v.coeff[(size_t)row * (size_t)taps],
+                                         dst_row, (int32_t)dst_stride, taps);
+}
+
+void pixctrl_generic_separable_resize_plane(pixctrl_resize_plane_t *plane, uint8_t *src, uint8_t *dst)
+{
+    const size_t dst_stride = (size_t)plane->dst_width * (size_t)plane->channels;
+    int32_t row;
+
+    pixctrl_generic_resize_plane_reset(plane);
+    for (row = 0; row < plane->dst_height; ++row)
+    {
+        pixctrl_generic_separable_resize_row(plane, src, row, dst + ((size_t)row * dst_stride));
+    }
+}
+
+/********************************************************************************************
+ *  Row Producer
+ ********************************************************************************************
+ */
+void pixctrl_generic_resize_plane_reset(pixctrl_resize_plane_t *plane)
+{
+    int32_t k;
+
+    if (plane->row_index != NULL)
+    {
+        for (k = 0; k < plane->v.taps; ++k)
+        {
+            plane->row_index[k] = -1;
+        }
+    }
+}
+
+void pixctrl_generic_resize_plane_row(pixctrl_resize_plane_t *plane, pixctrl_resize_method_t method,
+                                      uint8_t *src, int32_t row, uint8_t *dst_row)
+{
+    if (method == PIXCTRL_RESIZE_NEAREST_NEIGHBOR)
+    {
+        pixctrl_generic_nearest_neighbor_resize_row(plane, src, row, dst_row);
+    }
+    else
+    {
+        pixctrl_generic_separable_resize_row(plane, src, row, dst_row);
+    }
+}
+
+/********************************************************************************************
+ *  Resize Context
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_resize_create(pixctrl_fmt_t fmt, pixctrl_resize_method_t method,
+                                               int32_t src_width, int32_t src_height,
+                                               int32_t dst_width, int32_t dst_height,
+                                               pixctrl_resize_t **resize)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    int32_t src_plane_width[PIXCTRL_RESIZE_MAX_PLANES], src_plane_height[PIXCTRL_RESIZE_MAX_PLANES];
+    int32_t dst_plane_width[PIXCTRL_RESIZE_MAX_PLANES], dst_plane_height[PIXCTRL_RESIZE_MAX_PLANES];
+    int32_t channels[PIXCTRL_RESIZE_MAX_PLANES];
+    int32_t planes, i;
+    size_t src_offset = 0U, dst_offset = 0U, line_len = 0U;
+    pixctrl_resize_plane_t *plane;
+    pixctrl_resize_t *ctx = NULL;
+
+    if (resize == NULL)
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+    else if ((src_width <= 0) || (src_height <= 0) || (dst_width <= 0) || (dst_height <= 0))
+    {
+        result = PIXCTRL_INVALID_RANGE;
+    }
+    else if ((method != PIXCTRL_RESIZE_NEAREST_NEIGHBOR) && (method != PIXCTRL_RESIZE_BILINEAR) && (method != PIXCTRL_RESIZE_BICUBIC))
+    {
+        result = PIXCTRL_INVALID_ARGUMENT;
+    }
+    else
+    {
+        result = pixctrl_generic_resize_layout(fmt, src_width, src_height, &planes, src_plane_width, src_plane_height, channels);
+        if (result == PIXCTRL_SUCCESS)
+        {
+            result = pixctrl_generic_resize_layout(fmt, dst_width, dst_height, &planes, dst_plane_width, dst_plane_height, channels);
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        ctx = (pixctrl_resize_t *)calloc(1U, sizeof(pixctrl_resize_t));
+        if (ctx == NULL)
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        ctx->fmt = fmt;
+        ctx->method = method;
+        ctx->planes = planes;
+
+        for (i = 0; (i < planes) && (result == PIXCTRL_SUCCESS); ++i)
+        {
+            plane = &ctx->plane[i];
+            plane->src_width = src_plane_width[i];
+            plane->src_height = src_plane_height[i];
+            plane->dst_width = dst_plane_width[i];
+            plane->dst_height = dst_plane_height[i];
+            plane->channels = channels[i];
+            plane->src_offset = src_offset;
+            plane->dst_offset = dst_offset;
+            src_offset += (size_t)plane->src_width * (size_t)plane->src_height * (size_t)plane->channels;
+            dst_offset += (size_t)plane->dst_width * (size_t)plane->dst_height * (size_t)plane->channels;
+
+            result = pixctrl_generic_build_filter(&plane->h, plane->src_width, plane->dst_width, method);
+            if (result == PIXCTRL_SUCCESS)
+            {
+                result = pixctrl_generic_build_filter(&plane->v, plane->src_height, plane->dst_height, method);
+            }
+
+            line_len += (size_t)plane->dst_width * (size_t)plane->channels;
+
+            if ((result == PIXCTRL_SUCCESS) && (method != PIXCTRL_RESIZE_NEAREST_NEIGHBOR))
+            {
+                plane->rows = (int16_t *)malloc(sizeof(int16_t) * (size_t)plane->v.taps *
+                                                (size_t)plane->dst_width * (size_t)plane->channels);
+                plane->row_index = (int32_t *)malloc(sizeof(int32_t) * (size_t)plane->v.taps);
+                plane->row_ptr = (int16_t **)malloc(sizeof(int16_t *) * (size_t)plane->v.taps);
+                if ((plane->rows == NULL) || (plane->row_index == NULL) || (plane->row_ptr == NULL))
+                {
+                    result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+                }
+            }
+        }
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            ctx->line = (uint8_t *)malloc(line_len);
+            if (ctx->line == NULL)
+            {
+                result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+            }
+        }
+
+        if (result != PIXCTRL_SUCCESS)
+        {
+            pixctrl_generic_resize_destroy(ctx);
+            ctx = NULL;
+        }
+    }
+
+    if (resize != NULL)
+    {
+        *resize = ctx;
+    }
+
+    return result;
+}
+
+void pixctrl_generic_resize_destroy(pixctrl_resize_t *resize)
+{
+    int32_t i;
+
+    if (resize != NULL)
+    {
+        for (i = 0; i < PIXCTRL_RESIZE_MAX_PLANES; ++i)
+        {
+            free(resize->plane[i].h.offset);
+            free(resize->plane[i].h.coeff);
+            free(resize->plane[i].v.offset);
+            free(resize->plane[i].v.coeff);
+            free(resize->plane[i].rows);
+            free(resize->plane[i].row_index);
+            free(resize->plane[i].row_ptr);
+        }
+        free(resize->line);
+        free(resize);
+    }
+}
+
+pixctrl_result_t pixctrl_generic_resize(pixctrl_resize_t *resize, uint8_t *src, uint8_t *dst)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    pixctrl_resize_plane_t *plane;
+    int32_t i;
+    const int32_t width = (resize != NULL) ? resize->plane[0].src_width : 0;
+    const int32_t height = (resize != NULL) ? resize->plane[0].src_height : 0;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if ((resize != NULL) && (src != NULL) && (dst != NULL))
+    {
+        for (i = 0; i < resize->planes; ++i)
+        {
+            plane = &resize->plane[i];
+            if (resize->method == PIXCTRL_RESIZE_NEAREST_NEIGHBOR)
+            {
+                pixctrl_generic_nearest_neighbor_resize_plane(plane, src + plane->src_offset, dst + plane->dst_offset);
+            }
+            else
+            {
+                pixctrl_generic_separable_resize_plane(plane, src + plane->src_offset, dst + plane->dst_offset);
+            }
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+/* one-shot helper for the per-method entry points, the tables are rebuilt on every call */
+pixctrl_result_t pixctrl_generic_resize_once(pixctrl_fmt_t fmt, pixctrl_resize_method_t method,
+                                             uint8_t *src, int32_t src_width, int32_t src_height,
+                                             uint8_t *dst, int32_t dst_width, int32_t dst_height)
+{
+    pixctrl_resize_t *resize;
+    pixctrl_result_t result = pixctrl_generic_resize_create(fmt, method, src_width, src_height, dst_width, dst_height, &resize);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_resize(resize, src, dst);
+        pixctrl_generic_resize_destroy(resize);
+    }
+
+    return result;
+}
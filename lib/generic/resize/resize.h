@@ -0,0 +1,86 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef RESIZE_H
+#define RESIZE_H
+
+#define PIXCTRL_RESIZE_MAX_PLANES   (3)
+#define PIXCTRL_RESIZE_COEFF_BITS   (14)    /* Q14 filter coefficients */
+#define PIXCTRL_RESIZE_INTER_BITS   (6)     /* horizontally scaled rows keep 6 fractional bits */
+
+typedef struct {
+    int32_t taps;               /* coefficients per output sample */
+    int32_t *offset;            /* first source sample of each output sample */
+    int16_t *coeff;             /* 'taps' Q14 coefficients per output sample, summing to 1 << 14 */
+} pixctrl_resize_filter_t;
+
+typedef struct {
+    int32_t src_width;
+    int32_t src_height;
+    int32_t dst_width;
+    int32_t dst_height;
+    int32_t channels;           /* interleaved samples per pixel */
+    size_t src_offset;          /* plane offset from the start of the image */
+    size_t dst_offset;
+
+    pixctrl_resize_filter_t h;
+    pixctrl_resize_filter_t v;
+
+    int16_t *rows;              /* 'v.taps' horizontally scaled rows, indexed by source row % v.taps */
+    int32_t *row_index;         /* source row held by each cached row, -1 when empty */
+    int16_t **row_ptr;          /* cached rows feeding the current output row, in tap order */
+} pixctrl_resize_plane_t;
+
+struct pixctrl_resize {
+    pixctrl_fmt_t fmt;
+    pixctrl_resize_method_t method;
+    int32_t planes;
+    pixctrl_resize_plane_t plane[PIXCTRL_RESIZE_MAX_PLANES];
+    uint8_t *line;              /* one output row of every plane, the intermediate of the fused convert */
+};
+
+/* filter weight at distance 'x' in source samples, zero from PIXCTRL_*_SUPPORT on */
+typedef double (*pixctrl_resize_weight_t)(double x);
+
+extern double pixctrl_generic_bilinear_weight(double x);
+extern double pixctrl_generic_bicubic_weight(double x);
+
+#define PIXCTRL_BILINEAR_SUPPORT    (1.0)
+#define PIXCTRL_BICUBIC_SUPPORT     (2.0)
+
+extern pixctrl_result_t pixctrl_generic_resize_once(pixctrl_fmt_t fmt, pixctrl_resize_method_t method,
+                                                    uint8_t *src, int32_t src_width, int32_t src_height,
+                                                    uint8_t *dst, int32_t dst_width, int32_t dst_height);
+extern void pixctrl_generic_nearest_neighbor_resize_row(const pixctrl_resize_plane_t *plane, uint8_t *src, int32_t row, uint8_t *dst_row);
+extern void pixctrl_generic_nearest_neighbor_resize_plane(const pixctrl_resize_plane_t *plane, uint8_t *src, uint8_t *dst);
+extern void pixctrl_generic_separable_resize_row(pixctrl_resize_plane_t *plane, uint8_t *src, int32_t row, uint8_t *dst_row);
+extern void pixctrl_generic_separable_resize_plane(pixctrl_resize_plane_t *plane, uint8_t *src, uint8_t *dst);
+
+/* output rows of one plane on demand, the row cache must be reset once per frame */
+extern void pixctrl_generic_resize_plane_reset(pixctrl_resize_plane_t *plane);
+extern void pixctrl_generic_resize_plane_row(pixctrl_resize_plane_t *plane, pixctrl_resize_method_t method,
+                                             uint8_t *src, int32_t row, uint8_t *dst_row);
+
+#endif  /* !RESIZE_H */
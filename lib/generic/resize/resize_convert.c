@@ -0,0 +1,194 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/instrument.h"
+#include "generic/resize/resize.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+/* scale one rgb row into the line buffer, then convert it straight into the yuv420 planes */
+static pixctrl_result_t pixctrl_generic_core_resize_xrgb_to_yuv420(pixctrl_resize_t *resize, const pixctrl_rgb_order_t *src_order,
+                                                                   pixctrl_fmt_t dst_fmt, uint8_t *src, uint8_t *dst)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_resize_plane_t *plane = &resize->plane[0];
+    const int32_t width = plane->dst_width, height = plane->dst_height;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    pixctrl_plane_layout_t layout;
+    uint8_t *y_dst_row_base = dst, *uv_dst_row_base = NULL;
+    uint8_t *u_dst_row_base = NULL, *v_dst_row_base = NULL;
+    int32_t uv_stride = 0;
+    int32_t row;
+
+    if ((dst_fmt != PIXCTRL_FMT_NV12) && (dst_fmt != PIXCTRL_FMT_NV21) && (dst_fmt != PIXCTRL_FMT_YUV420P))
+    {
+        result = PIXCTRL_NOT_SUPPORT;
+    }
+    else
+    {
+        /* odd sizes are written with the ceil-sized chroma planes of the converters */
+        result = pixctrl_get_plane_layout(dst_fmt, width, height, &layout);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        uv_dst_row_base = dst + layout.offset[1];
+        u_dst_row_base = dst + layout.offset[1];
+        v_dst_row_base = dst + layout.offset[2];
+        uv_stride = layout.stride[1];
+
+        pixctrl_generic_resize_plane_reset(plane);
+        for (row = 0; row < height; ++row)
+        {
+            pixctrl_generic_resize_plane_row(plane, resize->method, src + plane->src_offset, row, resize->line);
+
+            if (dst_fmt == PIXCTRL_FMT_YUV420P)
+            {
+                pixctrl_generic_xrgb_to_yuv420p_line_stripe(resize->line, src_order,
+                                                            y_dst_row_base, u_dst_row_base, v_dst_row_base,
+                                                            width, row);
+            }
+            else
+            {
+                pixctrl_generic_xrgb_to_yuv420_line_stripe(resize->line, src_order,
+                                                           y_dst_row_base, uv_dst_row_base,
+                                                           (dst_fmt == PIXCTRL_FMT_NV12) ? &nv12 : &nv21,
+                                                           width, row);
+            }
+
+            y_dst_row_base += width;
+            if ((row % 2) != 0)
+            {
+                uv_dst_row_base += uv_stride;
+                u_dst_row_base += uv_stride;
+                v_dst_row_base += uv_stride;
+            }
+        }
+    }
+
+    return result;
+}
+
+/* scale one luma row and, every other row, one chroma row, then convert them straight into rgb */
+static pixctrl_result_t pixctrl_generic_core_resize_yuv420_to_xrgb(pixctrl_resize_t *resize, pixctrl_fmt_t dst_fmt,
+                                                                   uint8_t *src, uint8_t *dst)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    pixctrl_resize_plane_t *y_plane = &resize->plane[0];
+    const int32_t width = y_plane->dst_width, height = y_plane->dst_height;
+    pixctrl_result_t result;
+    pixctrl_rgb_order_t dst_order;
+    uint8_t *y_line = resize->line;
+    uint8_t *uv_line[2];
+    uint8_t *dst_row_base = dst;
+    int32_t row, uv_row, prev_uv_row = -1, i;
+
+    result = pixctrl_get_rgb_order(dst_fmt, &dst_order);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        uv_line[0] = y_line + width;
+        uv_line[1] = uv_line[0] + ((size_t)resize->plane[1].dst_width * (size_t)resize->plane[1].channels);
+
+        for (i = 0; i < resize->planes; ++i)
+        {
+            pixctrl_generic_resize_plane_reset(&resize->plane[i]);
+        }
+
+        for (row = 0; row < height; ++row)
+        {
+            pixctrl_generic_resize_plane_row(y_plane, resize->method, src + y_plane->src_offset, row, y_line);
+
+            uv_row = row / 2;
+            uv_row = (uv_row < resize->plane[1].dst_height) ? uv_row : (resize->plane[1].dst_height - 1);
+            if (uv_row != prev_uv_row)
+            {
+                for (i = 1; i < resize->planes; ++i)
+                {
+                    pixctrl_generic_resize_plane_row(&resize->plane[i], resize->method,
+                                                     src + resize->plane[i].src_offset, uv_row, uv_line[i - 1]);
+                }
+                prev_uv_row = uv_row;
+            }
+
+            if (resize->fmt == PIXCTRL_FMT_YUV420P)
+            {
+                pixctrl_generic_yuv420p_to_xrgb_line_stripe(y_line, uv_line[0], uv_line[1], dst_row_base, &dst_order, width);
+            }
+            else
+            {
+                pixctrl_generic_yuv420_to_xrgb_line_stripe(y_line, uv_line[0], (resize->fmt == PIXCTRL_FMT_NV12) ? &nv12 : &nv21,
+                                                           dst_row_base, &dst_order, width);
+            }
+            dst_row_base += (size_t)width * (size_t)dst_order.bpp;
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  resize and convert
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_resize_convert(pixctrl_resize_t *resize, uint8_t *src, pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    pixctrl_result_t result;
+    pixctrl_rgb_order_t src_order;
+    const int32_t width = (resize != NULL) ? resize->plane[0].src_width : 0;
+    const int32_t height = (resize != NULL) ? resize->plane[0].src_height : 0;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if ((resize != NULL) && (src != NULL) && (dst != NULL))
+    {
+        switch (resize->fmt)
+        {
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+        case PIXCTRL_FMT_YUV420P:
+            result = pixctrl_generic_core_resize_yuv420_to_xrgb(resize, dst_fmt, src, dst);
+            break;
+        default:
+            result = pixctrl_get_rgb_order(resize->fmt, &src_order);
+            if (result == PIXCTRL_SUCCESS)
+            {
+                result = pixctrl_generic_core_resize_xrgb_to_yuv420(resize, &src_order, dst_fmt, src, dst);
+            }
+            break;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
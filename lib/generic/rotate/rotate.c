@@ -0,0 +1,417 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+#include "generic/rotate/rotate.h"
+
+typedef struct {
+    int32_t width;              /* in samples of 'elem' bytes */
+    int32_t height;
+    size_t elem;                /* bytes per sample, a packed yuv422 sample is one Y0-U-Y1-V macro pixel */
+    size_t offset;              /* plane offset from the start of the image, the same for source and destination */
+} pixctrl_transform_plane_t;
+
+/********************************************************************************************
+ *  Plane Layout
+ ********************************************************************************************
+ */
+/* odd sizes keep the ceil-sized chroma planes of pixctrl_get_plane_layout(), each plane is transformed on its own */
+static pixctrl_result_t pixctrl_generic_transform_layout(pixctrl_fmt_t fmt, int32_t width, int32_t height,
+                                                         pixctrl_transform_plane_t *plane, int32_t *planes)
+{
+    pixctrl_plane_layout_t layout;
+    pixctrl_result_t result = pixctrl_get_plane_layout(fmt, width, height, &layout);
+    int32_t i;
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        *planes = layout.planes;
+        for (i = 0; i < layout.planes; ++i)
+        {
+            plane[i].elem = 1U;
+        }
+
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_RGBA32:
+        case PIXCTRL_FMT_BGRA32:
+        case PIXCTRL_FMT_ARGB32:
+        case PIXCTRL_FMT_ABGR32:
+        case PIXCTRL_FMT_RGBX32:
+        case PIXCTRL_FMT_BGRX32:
+        case PIXCTRL_FMT_XRGB32:
+        case PIXCTRL_FMT_XBGR32:
+        case PIXCTRL_FMT_YUYV422:
+        case PIXCTRL_FMT_YVYU422:
+        case PIXCTRL_FMT_UYVY422:
+        case PIXCTRL_FMT_VYUY422:
+            plane[0].elem = 4U;
+            break;
+        case PIXCTRL_FMT_BGR24:
+        case PIXCTRL_FMT_RGB24:
+        case PIXCTRL_FMT_YUV444:
+            plane[0].elem = 3U;
+            break;
+        case PIXCTRL_FMT_NV12:
+        case PIXCTRL_FMT_NV21:
+            plane[1].elem = 2U;
+            break;
+        case PIXCTRL_FMT_GRAY8:
+        case PIXCTRL_FMT_YUV444P:
+        case PIXCTRL_FMT_YUV422P:
+        case PIXCTRL_FMT_YUV420P:
+            break;
+        default:
+            result = PIXCTRL_NOT_SUPPORT;
+            break;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        for (i = 0; i < layout.planes; ++i)
+        {
+            plane[i].width = layout.stride[i] / (int32_t)plane[i].elem;
+            plane[i].height = layout.height[i];
+            plane[i].offset = layout.offset[i];
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+/* copy one tile, walking the source by 'row_step' per destination row and by 'col_step' per destination column */
+static inline void pixctrl_generic_core_transform_tile(uint8_t *src, ptrdiff_t row_step, ptrdiff_t col_step,
+                                                       uint8_t *dst, size_t dst_stride,
+                                                       int32_t rows, int32_t cols, const size_t elem)
+{
+    register int32_t row, col;
+    register uint8_t *src_pos;
+    register uint8_t *dst_pos;
+
+    for (row = 0; row < rows; ++row)
+    {
+        src_pos = src + ((ptrdiff_t)row * row_step);
+        dst_pos = dst + ((size_t)row * dst_stride);
+        for (col = 0; col < cols; ++col)
+        {
+            (void)memcpy(dst_pos, src_pos, elem);
+            dst_pos += elem;
+            src_pos += col_step;
+        }
+    }
+}
+
+static inline void pixctrl_generic_core_transform_rows(uint8_t *src, ptrdiff_t row_step, ptrdiff_t col_step,
+                                                       uint8_t *dst, int32_t dst_width, int32_t rows,
+                                                       const size_t elem, const int32_t tile_rows, const int32_t tile_cols)
+{
+    const size_t dst_stride = (size_t)dst_width * elem;
+    register int32_t row, col, block_rows, block_cols;
+
+    for (row = 0; row < rows; row += tile_rows)
+    {
+        block_rows = ((rows - row) < tile_rows) ? (rows - row) : tile_rows;
+        for (col = 0; col < dst_width; col += tile_cols)
+        {
+            block_cols = ((dst_width - col) < tile_cols) ? (dst_width - col) : tile_cols;
+            pixctrl_generic_core_transform_tile(src + ((ptrdiff_t)row * row_step) + ((ptrdiff_t)col * col_step), row_step, col_step,
+                                                dst + ((size_t)row * dst_stride) + ((size_t)col * elem), dst_stride,
+                                                block_rows, block_cols, elem);
+        }
+    }
+}
+
+/* the luma samples of a mirrored packed yuv422 macro pixel trade places: Y0-U-Y1-V becomes Y1-U-Y0-V. An odd
+ * row ends in a padding sample, so there Y0 stays and Y1 comes from the next macro pixel, the last replicating Y0 */
+static void pixctrl_generic_core_mirror_luma(uint8_t *buf, int32_t width, int32_t height, const size_t iy)
+{
+    const size_t stride = (size_t)((width + 1) / 2) * 4U;
+    const size_t last = stride - 4U;
+    register size_t pos;
+    register uint8_t tmp;
+    uint8_t *row = buf;
+    int32_t y;
+
+    for (y = 0; y < height; ++y)
+    {
+        if ((width % 2) == 0)
+        {
+            for (pos = 0U; pos < stride; pos += 4U)
+            {
+                tmp = row[pos + iy];
+                row[pos + iy] = row[pos + iy + 2U];
+                row[pos + iy + 2U] = tmp;
+            }
+        }
+        else
+        {
+            for (pos = 0U; pos < last; pos += 4U)
+            {
+                row[pos + iy + 2U] = row[pos + 4U + iy + 2U];
+            }
+            row[last + iy + 2U] = row[last + iy];
+        }
+        row += stride;
+    }
+}
+
+void pixctrl_generic_transform_rows(uint8_t *src, int32_t src_width, int32_t src_height, size_t elem,
+                                    pixctrl_transform_t transform,
+                                    uint8_t *dst, int32_t row_begin, int32_t row_end)
+{
+    const ptrdiff_t stride = (ptrdiff_t)((size_t)src_width * elem);
+    const ptrdiff_t step = (ptrdiff_t)elem;
+    const int32_t rows = row_end - row_begin;
+    int32_t dst_width = src_width, tile_rows = 1, tile_cols = src_width, row;
+    ptrdiff_t row_step, col_step;
+    uint8_t *origin;
+
+    switch (transform)
+    {
+    case PIXCTRL_TRANSFORM_FLIP_HORIZONTAL:
+        origin = src + ((ptrdiff_t)(src_width - 1) * step);
+        row_step = stride;
+        col_step = -step;
+        break;
+    case PIXCTRL_TRANSFORM_ROTATE_180:
+        origin = src + ((ptrdiff_t)(src_height - 1) * stride) + ((ptrdiff_t)(src_width - 1) * step);
+        row_step = -stride;
+        col_step = -step;
+        break;
+    case PIXCTRL_TRANSFORM_ROTATE_90:
+        /* destination (row, col) is source (x = row, y = height - 1 - col) */
+        origin = src + ((ptrdiff_t)(src_height - 1) * stride);
+        row_step = step;
+        col_step = -stride;
+        dst_width = src_height;
+        break;
+    case PIXCTRL_TRANSFORM_ROTATE_270:
+        /* destination (row, col) is source (x = width - 1 - row, y = col) */
+        origin = src + ((ptrdiff_t)(src_width - 1) * step);
+        row_step = -step;
+        col_step = stride;
+        dst_width = src_height;
+        break;
+    case PIXCTRL_TRANSFORM_FLIP_VERTICAL:
+        origin = src + ((ptrdiff_t)(src_height - 1) * stride);
+        row_step = -stride;
+        col_step = step;
+        break;
+    case PIXCTRL_TRANSFORM_COPY:
+    default:
+        origin = src;
+        row_step = stride;
+        col_step = step;
+        break;
+    }
+    origin += (ptrdiff_t)row_begin * row_step;
+
+    /* a one sample wide quarter turn steps like a copy, but still reads down the columns */
+    if ((col_step == step) && (dst_width == src_width))
+    {
+        /* rows stay intact, only their order may change */
+        for (row = 0; row < rows; ++row)
+        {
+            (void)memcpy(dst + ((size_t)row * (size_t)stride), origin + ((ptrdiff_t)row * row_step), (size_t)stride);
+        }
+    }
+    else
+    {
+        if ((transform == PIXCTRL_TRANSFORM_ROTATE_90) || (transform == PIXCTRL_TRANSFORM_ROTATE_270))
+        {
+            /* a transpose reads across source rows, so walk it in tiles that stay in L1 */
+            tile_rows = (elem <= 2U) ? PIXCTRL_ROTATE_TILE_SMALL : PIXCTRL_ROTATE_TILE_LARGE;
+            tile_cols = tile_rows;
+        }
+
+        /* dispatch the known sample sizes to constant-size copies so the compiler can inline them */
+        switch (elem)
+        {
+        case 1U:
+            pixctrl_generic_core_transform_rows(origin, row_step, col_step, dst, dst_width, rows, 1U, tile_rows, tile_cols);
+            break;
+        case 2U:
+            pixctrl_generic_core_transform_rows(origin, row_step, col_step, dst, dst_width, rows, 2U, tile_rows, tile_cols);
+            break;
+        case 3U:
+            pixctrl_generic_core_transform_rows(origin, row_step, col_step, dst, dst_width, rows, 3U, tile_rows, tile_cols);
+            break;
+        case 4U:
+            pixctrl_generic_core_transform_rows(origin, row_step, col_step, dst, dst_width, rows, 4U, tile_rows, tile_cols);
+            break;
+        default:
+            pixctrl_generic_core_transform_rows(origin, row_step, col_step, dst, dst_width, rows, elem, tile_rows, tile_cols);
+            break;
+        }
+    }
+}
+
+static pixctrl_result_t pixctrl_generic_core_transform(pixctrl_fmt_t fmt, pixctrl_transform_t transform,
+                                                       uint8_t *src, int32_t width, int32_t height, uint8_t *dst)
+{
+    const int32_t transpose = ((transform == PIXCTRL_TRANSFORM_ROTATE_90) || (transform == PIXCTRL_TRANSFORM_ROTATE_270)) ? 1 : 0;
+    pixctrl_transform_plane_t plane[3];
+    pixctrl_result_t result;
+    int32_t planes = 0, i;
+
+    result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_transform_layout(fmt, width, height, plane, &planes);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        switch (fmt)
+        {
+        case PIXCTRL_FMT_YUYV422:
+        case PIXCTRL_FMT_YVYU422:
+        case PIXCTRL_FMT_UYVY422:
+        case PIXCTRL_FMT_VYUY422:
+        case PIXCTRL_FMT_YUV422P:
+            /* a quarter turn would move the chroma subsampling to the vertical axis, which yuv422 cannot hold */
+            result = (transpose != 0) ? PIXCTRL_NOT_SUPPORT : PIXCTRL_SUCCESS;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (src == dst)
+        {
+            result = PIXCTRL_INVALID_ARGUMENT;
+        }
+        else
+        {
+            for (i = 0; i < planes; ++i)
+            {
+                pixctrl_generic_transform_rows(src + plane[i].offset, plane[i].width, plane[i].height, plane[i].elem, transform,
+                                               dst + plane[i].offset, 0, (transpose != 0) ? plane[i].width : plane[i].height);
+            }
+
+            if ((transform == PIXCTRL_TRANSFORM_FLIP_HORIZONTAL) || (transform == PIXCTRL_TRANSFORM_ROTATE_180))
+            {
+                switch (fmt)
+                {
+                case PIXCTRL_FMT_YUYV422:
+                case PIXCTRL_FMT_YVYU422:
+                    pixctrl_generic_core_mirror_luma(dst, width, height, 0U);
+                    break;
+                case PIXCTRL_FMT_UYVY422:
+                case PIXCTRL_FMT_VYUY422:
+                    pixctrl_generic_core_mirror_luma(dst, width, height, 1U);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  rotate and flip
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rotate_to_transform(pixctrl_rotate_t rotate, pixctrl_transform_t *transform)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    switch (rotate)
+    {
+    case PIXCTRL_ROTATE_0:
+        *transform = PIXCTRL_TRANSFORM_COPY;
+        break;
+    case PIXCTRL_ROTATE_90:
+        *transform = PIXCTRL_TRANSFORM_ROTATE_90;
+        break;
+    case PIXCTRL_ROTATE_180:
+        *transform = PIXCTRL_TRANSFORM_ROTATE_180;
+        break;
+    case PIXCTRL_ROTATE_270:
+        *transform = PIXCTRL_TRANSFORM_ROTATE_270;
+        break;
+    default:
+        result = PIXCTRL_INVALID_ARGUMENT;
+        break;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_rotate(pixctrl_fmt_t fmt, pixctrl_rotate_t rotate, uint8_t *src, int32_t width, int32_t height, uint8_t *dst)
+{
+    pixctrl_result_t result;
+    pixctrl_transform_t transform;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    result = pixctrl_generic_rotate_to_transform(rotate, &transform);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_core_transform(fmt, transform, src, width, height, dst);
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_flip(pixctrl_fmt_t fmt, pixctrl_flip_t flip, uint8_t *src, int32_t width, int32_t height, uint8_t *dst)
+{
+    pixctrl_result_t result;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    switch (flip)
+    {
+    case PIXCTRL_FLIP_HORIZONTAL:
+        result = pixctrl_generic_core_transform(fmt, PIXCTRL_TRANSFORM_FLIP_HORIZONTAL, src, width, height, dst);
+        break;
+    case PIXCTRL_FLIP_VERTICAL:
+        result = pixctrl_generic_core_transform(fmt, PIXCTRL_TRANSFORM_FLIP_VERTICAL, src, width, height, dst);
+        break;
+    default:
+        result = PIXCTRL_INVALID_ARGUMENT;
+        break;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
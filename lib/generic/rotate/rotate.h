@@ -0,0 +1,49 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ROTATE_H
+#define ROTATE_H
+
+/* tiles of the transposing walks, 16x16 for 1 and 2 byte elements, 8x8 for 3 and 4 byte elements */
+#define PIXCTRL_ROTATE_TILE_SMALL   (16)
+#define PIXCTRL_ROTATE_TILE_LARGE   (8)
+
+typedef enum {
+    PIXCTRL_TRANSFORM_COPY,
+    PIXCTRL_TRANSFORM_FLIP_HORIZONTAL,
+    PIXCTRL_TRANSFORM_FLIP_VERTICAL,
+    PIXCTRL_TRANSFORM_ROTATE_90,
+    PIXCTRL_TRANSFORM_ROTATE_180,
+    PIXCTRL_TRANSFORM_ROTATE_270,
+} pixctrl_transform_t;
+
+extern pixctrl_result_t pixctrl_generic_rotate_to_transform(pixctrl_rotate_t rotate, pixctrl_transform_t *transform);
+
+/* writes destination rows [row_begin, row_end) of one plane of 'elem' byte samples to 'dst', which points at 'row_begin' */
+extern void pixctrl_generic_transform_rows(uint8_t *src, int32_t src_width, int32_t src_height, size_t elem,
+                                           pixctrl_transform_t transform,
+                                           uint8_t *dst, int32_t row_begin, int32_t row_end);
+
+#endif  /* !ROTATE_H */
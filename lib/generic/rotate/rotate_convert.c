@@ -0,0 +1,153 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdlib.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+#include "generic/rotate/rotate.h"
+
+/********************************************************************************************
+ *  Core Function
+ ********************************************************************************************
+ */
+/* rotate a band of rgb rows into a small buffer, then convert it straight into the yuv420 planes */
+static pixctrl_result_t pixctrl_generic_core_rotate_xrgb_to_yuv420(uint8_t *src, const pixctrl_rgb_order_t *src_order,
+                                                                   int32_t src_width, int32_t src_height,
+                                                                   pixctrl_transform_t transform,
+                                                                   pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    static const pixctrl_yuv_order_t nv12 = INIT_PIXCTRL_ORDER_NV12, nv21 = INIT_PIXCTRL_ORDER_NV21;
+    const int32_t transpose = ((transform == PIXCTRL_TRANSFORM_ROTATE_90) || (transform == PIXCTRL_TRANSFORM_ROTATE_270)) ? 1 : 0;
+    const int32_t width = (transpose != 0) ? src_height : src_width;
+    const int32_t height = (transpose != 0) ? src_width : src_height;
+    const int32_t band_rows = PIXCTRL_ROTATE_TILE_SMALL;
+    const size_t band_stride = (size_t)width * (size_t)src_order->bpp;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    pixctrl_plane_layout_t layout;
+    uint8_t *y_dst_row_base = dst, *uv_dst_row_base = NULL;
+    uint8_t *u_dst_row_base = NULL, *v_dst_row_base = NULL;
+    uint8_t *band, *line;
+    int32_t uv_stride = 0;
+    int32_t band_begin, band_end, row;
+
+    if ((dst_fmt != PIXCTRL_FMT_NV12) && (dst_fmt != PIXCTRL_FMT_NV21) && (dst_fmt != PIXCTRL_FMT_YUV420P))
+    {
+        result = PIXCTRL_NOT_SUPPORT;
+    }
+    else
+    {
+        /* odd sizes are written with the ceil-sized chroma planes of the converters */
+        result = pixctrl_get_plane_layout(dst_fmt, width, height, &layout);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        uv_dst_row_base = dst + layout.offset[1];
+        u_dst_row_base = dst + layout.offset[1];
+        v_dst_row_base = dst + layout.offset[2];
+        uv_stride = layout.stride[1];
+
+        band = (uint8_t *)malloc(band_stride * (size_t)band_rows);
+        if (band == NULL)
+        {
+            result = PIXCTRL_MEMORY_ALLOCATION_IS_FAILED;
+        }
+        else
+        {
+            for (band_begin = 0; band_begin < height; band_begin += band_rows)
+            {
+                band_end = ((height - band_begin) < band_rows) ? height : (band_begin + band_rows);
+                pixctrl_generic_transform_rows(src, src_width, src_height, (size_t)src_order->bpp, transform,
+                                               band, band_begin, band_end);
+
+                line = band;
+                for (row = band_begin; row < band_end; ++row)
+                {
+                    if (dst_fmt == PIXCTRL_FMT_YUV420P)
+                    {
+                        pixctrl_generic_xrgb_to_yuv420p_line_stripe(line, src_order,
+                                                                    y_dst_row_base, u_dst_row_base, v_dst_row_base,
+                                                                    width, row);
+                    }
+                    else
+                    {
+                        pixctrl_generic_xrgb_to_yuv420_line_stripe(line, src_order,
+                                                                   y_dst_row_base, uv_dst_row_base,
+                                                                   (dst_fmt == PIXCTRL_FMT_NV12) ? &nv12 : &nv21,
+                                                                   width, row);
+                    }
+
+                    line += band_stride;
+                    y_dst_row_base += width;
+                    if ((row % 2) != 0)
+                    {
+                        uv_dst_row_base += uv_stride;
+                        u_dst_row_base += uv_stride;
+                        v_dst_row_base += uv_stride;
+                    }
+                }
+            }
+            free(band);
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  rotate and convert
+ ********************************************************************************************
+ */
+pixctrl_result_t pixctrl_generic_rotate_convert(pixctrl_fmt_t src_fmt, pixctrl_rotate_t rotate,
+                                                uint8_t *src, int32_t width, int32_t height,
+                                                pixctrl_fmt_t dst_fmt, uint8_t *dst)
+{
+    pixctrl_result_t result;
+    pixctrl_rgb_order_t src_order;
+    pixctrl_transform_t transform;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_rotate_to_transform(rotate, &transform);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_get_rgb_order(src_fmt, &src_order);
+    }
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        result = pixctrl_generic_core_rotate_xrgb_to_yuv420(src, &src_order, width, height, transform, dst_fmt, dst);
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
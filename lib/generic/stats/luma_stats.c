@@ -0,0 +1,211 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "pixctrl.h"
+#include "common/util.h"
+#include "common/instrument.h"
+#include "generic/stats/luma_stats.h"
+
+/********************************************************************************************
+ *  Luma Statistics
+ ********************************************************************************************
+ */
+/* samples of the 'zone'-th of 'zones' zones along an axis of 'length' samples, see the line stripe */
+static inline uint64_t pixctrl_luma_stats_zone_length(int32_t zone, int32_t zones, int32_t length)
+{
+    return (uint64_t)(((((zone + 1) * length) + (zones - 1)) / zones) - (((zone * length) + (zones - 1)) / zones));
+}
+
+pixctrl_result_t pixctrl_luma_stats_init(pixctrl_luma_stats_t *stats, int32_t width, int32_t height,
+                                         int32_t zones_x, int32_t zones_y)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+
+    if (stats != NULL)
+    {
+        if ((0 < width) && (0 < height) &&
+            (0 < zones_x) && (zones_x <= PIXCTRL_LUMA_STATS_MAX_ZONES) && (zones_x <= width) &&
+            (0 < zones_y) && (zones_y <= PIXCTRL_LUMA_STATS_MAX_ZONES) && (zones_y <= height))
+        {
+            (void)memset(stats, 0, sizeof(*stats));
+            stats->width = width;
+            stats->height = height;
+            stats->zones_x = zones_x;
+            stats->zones_y = zones_y;
+            stats->min = UINT8_MAX;
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_luma_stats_merge(pixctrl_luma_stats_t *dst, const pixctrl_luma_stats_t *src)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    register int32_t i;
+
+    if ((dst != NULL) && (src != NULL))
+    {
+        if ((dst->width == src->width) && (dst->height == src->height) &&
+            (dst->zones_x == src->zones_x) && (dst->zones_y == src->zones_y))
+        {
+            for (i = 0; i < PIXCTRL_LUMA_STATS_BINS; ++i)
+            {
+                dst->histogram[i] += src->histogram[i];
+            }
+            for (i = 0; i < (dst->zones_x * dst->zones_y); ++i)
+            {
+                dst->zone_sum[i] += src->zone_sum[i];
+            }
+            dst->count += src->count;
+            dst->sum += src->sum;
+            dst->min = (src->min < dst->min) ? src->min : dst->min;
+            dst->max = (src->max > dst->max) ? src->max : dst->max;
+        }
+        else
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_luma_stats_finish(pixctrl_luma_stats_t *stats)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    uint64_t area;
+    register int32_t zx, zy, zone;
+
+    if (stats != NULL)
+    {
+        stats->mean = (stats->count != 0U) ? (uint8_t)((stats->sum + (stats->count / 2U)) / stats->count) : 0U;
+
+        for (zy = 0; zy < stats->zones_y; ++zy)
+        {
+            for (zx = 0; zx < stats->zones_x; ++zx)
+            {
+                zone = (zy * stats->zones_x) + zx;
+                area = pixctrl_luma_stats_zone_length(zx, stats->zones_x, stats->width) *
+                       pixctrl_luma_stats_zone_length(zy, stats->zones_y, stats->height);
+                stats->zone_mean[zone] = (uint8_t)((stats->zone_sum[zone] + (area / 2U)) / area);
+            }
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_luma_stats(uint8_t *src, pixctrl_luma_stats_t *stats)
+{
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    uint8_t *src_row_base = src;
+    register int32_t row;
+    const int32_t width = (stats != NULL) ? stats->width : 0;
+    const int32_t height = (stats != NULL) ? stats->height : 0;
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if ((src != NULL) && (stats != NULL))
+    {
+        for (row = 0; row < stats->height; ++row)
+        {
+            pixctrl_generic_luma_stats_line_stripe(src_row_base, row, stats);
+            src_row_base += stats->width;
+        }
+    }
+    else
+    {
+        result = PIXCTRL_MUST_NOT_BE_NULL;
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
+
+pixctrl_result_t pixctrl_generic_convert_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                         pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                         pixctrl_luma_stats_t *stats)
+{
+    pixctrl_result_t result = pixctrl_check_validation_of_parameters(src, dst, width, height);
+
+    PIXCTRL_TRACE_BEGIN(width, height);
+
+    if (result == PIXCTRL_SUCCESS)
+    {
+        if (stats == NULL)
+        {
+            result = PIXCTRL_MUST_NOT_BE_NULL;
+        }
+        else if ((stats->width != width) || (stats->height != height))
+        {
+            result = PIXCTRL_INVALID_RANGE;
+        }
+        else
+        {
+            switch (src_fmt)
+            {
+            case PIXCTRL_FMT_RGBA32:
+            case PIXCTRL_FMT_BGRA32:
+            case PIXCTRL_FMT_ARGB32:
+            case PIXCTRL_FMT_ABGR32:
+            case PIXCTRL_FMT_RGBX32:
+            case PIXCTRL_FMT_BGRX32:
+            case PIXCTRL_FMT_XRGB32:
+            case PIXCTRL_FMT_XBGR32:
+            case PIXCTRL_FMT_BGR24:
+            case PIXCTRL_FMT_RGB24:
+                result = pixctrl_generic_rgb_to_yuv420_with_luma_stats(src_fmt, src, width, height, dst_fmt, dst, stats);
+                break;
+            default:
+                result = pixctrl_generic_yuv_to_yuv420_with_luma_stats(src_fmt, src, width, height, dst_fmt, dst, stats);
+                break;
+            }
+        }
+    }
+
+    PIXCTRL_TRACE_END(width, height, result);
+
+    return result;
+}
@@ -0,0 +1,37 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LUMA_STATS_H
+#define LUMA_STATS_H
+
+/* converter entry points that hand every written 'Y' row to pixctrl_generic_luma_stats_line_stripe() */
+extern pixctrl_result_t pixctrl_generic_rgb_to_yuv420_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                                      pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                                      pixctrl_luma_stats_t *stats);
+extern pixctrl_result_t pixctrl_generic_yuv_to_yuv420_with_luma_stats(pixctrl_fmt_t src_fmt, uint8_t *src, int32_t width, int32_t height,
+                                                                      pixctrl_fmt_t dst_fmt, uint8_t *dst,
+                                                                      pixctrl_luma_stats_t *stats);
+
+#endif  /* !LUMA_STATS_H */
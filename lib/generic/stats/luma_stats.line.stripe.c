@@ -0,0 +1,64 @@
+/* 
+ * pixctrl - a low level pixel control library
+ *
+ * MIT License
+ * 
+ * Copyright (c) 2025 JunKi(Dylan) Hong
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <stdint.h>
+#include "pixctrl.h"
+
+/********************************************************************************************
+ *  Luma Statistics Line-Stripe
+ ********************************************************************************************
+ */
+void pixctrl_generic_luma_stats_line_stripe(uint8_t *src, int32_t row, pixctrl_luma_stats_t *stats)
+{
+    register uint32_t *histogram = stats->histogram;
+    uint64_t *zone_sum = &stats->zone_sum[((row * stats->zones_y) / stats->height) * stats->zones_x];
+    register uint32_t zone_acc, luma;
+    register uint32_t min = stats->min, max = stats->max;
+    uint64_t row_sum = 0U;
+    register int32_t col = 0, col_end, zone;
+
+    /* one zone segment at a time, so the zone sum stays in a register for the whole segment,
+     * sample 'i' of 'n' lands in zone (i * zones / n), which ends where ((zone + 1) * n) / zones rounds up */
+    for (zone = 0; zone < stats->zones_x; ++zone)
+    {
+        col_end = (((zone + 1) * stats->width) + (stats->zones_x - 1)) / stats->zones_x;
+        zone_acc = 0U;
+        for (; col < col_end; ++col)
+        {
+            luma = src[col];
+            histogram[luma]++;
+            zone_acc += luma;
+            min = (luma < min) ? luma : min;
+            max = (luma > max) ? luma : max;
+        }
+        zone_sum[zone] += zone_acc;
+        row_sum += zone_acc;
+    }
+
+    stats->min = (uint8_t)min;
+    stats->max = (uint8_t)max;
+    stats->sum += row_sum;
+    stats->count += (uint64_t)stats->width;
+}
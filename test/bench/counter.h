@@ -0,0 +1,29 @@
+#ifndef __COUNTER__H__
+#define __COUNTER__H__
+
+typedef enum {
+    BENCH_COUNTER_CYCLES,
+    BENCH_COUNTER_INSTRUCTIONS,
+    BENCH_COUNTER_L1D_MISSES,
+    BENCH_COUNTER_LLC_MISSES,
+    BENCH_COUNTER_DTLB_MISSES,
+    MAX_OF_BENCH_COUNTER,
+} bench_counter_id_t;
+
+typedef struct {
+    int32_t fd[MAX_OF_BENCH_COUNTER];           /* -1 when the counter could not be opened */
+    uint64_t value[MAX_OF_BENCH_COUNTER];
+} bench_counter_t;
+
+/* counts the calling thread in user space, returns how many counters could be opened */
+extern int32_t open_bench_counter(bench_counter_t *counter);
+extern void close_bench_counter(bench_counter_t *counter);
+
+/* start/stop accumulate, so only the timed runs are counted */
+extern void start_bench_counter(bench_counter_t *counter);
+extern void stop_bench_counter(bench_counter_t *counter);
+
+/* returns 0 and fills 'value' with the total since open_bench_counter(), -1 if the counter is unavailable */
+extern int32_t read_bench_counter(bench_counter_t *counter, bench_counter_id_t id, uint64_t *value);
+
+#endif  //!__COUNTER__H__
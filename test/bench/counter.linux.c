@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "counter.h"
+
+typedef struct {
+    uint32_t type;
+    uint64_t config;
+} bench_counter_event_t;
+
+#define HW_CACHE_READ_MISS(cache)   ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const bench_counter_event_t gsc_bench_counter_event[MAX_OF_BENCH_COUNTER] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,                     },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,                   },
+    { PERF_TYPE_HW_CACHE, HW_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_L1D),  },
+    { PERF_TYPE_HW_CACHE, HW_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_LL),   },
+    { PERF_TYPE_HW_CACHE, HW_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_DTLB), },
+};
+
+int32_t open_bench_counter(bench_counter_t *counter)
+{
+    struct perf_event_attr attr;
+    int32_t i, opened = 0;
+
+    assert(counter != NULL);
+
+    for (i = 0; i < MAX_OF_BENCH_COUNTER; ++i)
+    {
+        (void)memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = gsc_bench_counter_event[i].type;
+        attr.config = gsc_bench_counter_event[i].config;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;    /* stays usable with perf_event_paranoid 2 */
+        attr.exclude_hv = 1;
+
+        /* calling thread on any cpu; the counters are opened one by one, a missing event drops only itself */
+        counter->fd[i] = (int32_t)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0UL);
+        counter->value[i] = 0U;
+        if (counter->fd[i] >= 0)
+        {
+            (void)ioctl(counter->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ++opened;
+        }
+    }
+
+    return opened;
+}
+
+void close_bench_counter(bench_counter_t *counter)
+{
+    int32_t i;
+
+    assert(counter != NULL);
+
+    for (i = 0; i < MAX_OF_BENCH_COUNTER; ++i)
+    {
+        if (counter->fd[i] >= 0)
+        {
+            (void)close(counter->fd[i]);
+            counter->fd[i] = -1;
+        }
+    }
+}
+
+void start_bench_counter(bench_counter_t *counter)
+{
+    int32_t i;
+
+    for (i = 0; i < MAX_OF_BENCH_COUNTER; ++i)
+    {
+        if (counter->fd[i] >= 0)
+        {
+            (void)ioctl(counter->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void stop_bench_counter(bench_counter_t *counter)
+{
+    int32_t i;
+
+    for (i = 0; i < MAX_OF_BENCH_COUNTER; ++i)
+    {
+        if (counter->fd[i] >= 0)
+        {
+            (void)ioctl(counter->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+}
+
+int32_t read_bench_counter(bench_counter_t *counter, bench_counter_id_t id, uint64_t *value)
+{
+    int32_t result = -1;
+    uint64_t data[3];   /* value, time enabled, time running */
+
+    assert((counter != NULL) && (value != NULL));
+
+    if ((counter->fd[id] >= 0) && (read(counter->fd[id], data, sizeof(data)) == (ssize_t)sizeof(data)) &&
+        (data[2] != 0U))
+    {
+        /* scaled up when the pmu had to multiplex more events than it has counters */
+        counter->value[id] = (uint64_t)((double)data[0] * ((double)data[1] / (double)data[2]));
+        *value = counter->value[id];
+        result = 0;
+    }
+
+    return result;
+}
@@ -0,0 +1,780 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include <math.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#endif
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+#include "counter.h"
+
+#define DEFAULT_WARMUPS         (5)
+#define DEFAULT_REPETITIONS     (100)
+#define BENCH_ALIGNMENT         (64)
+
+typedef enum {
+    BENCH_KERNEL_CONVERT,
+    BENCH_KERNEL_MEMCPY,        /* memcpy() moving as many bytes as the converter reads and writes */
+    BENCH_KERNEL_STREAM,        /* reads 'src_len' bytes, then writes 'dst_len' bytes */
+} bench_kernel_t;
+
+typedef enum {
+    BENCH_LEVEL_L1,
+    BENCH_LEVEL_L2,
+    BENCH_LEVEL_LLC,
+    BENCH_LEVEL_DRAM,
+    MAX_OF_BENCH_LEVEL,
+} bench_level_t;
+
+typedef struct {
+    const char *name;
+    const convert_test_vector_t *(*get_vector)(int32_t *test_vectors);
+} bench_table_t;
+
+typedef struct {
+    const char *filter;
+    int32_t width;
+    int32_t height;
+    int32_t threads;
+    int32_t warmups;
+    int32_t repetitions;
+    int32_t counters;
+    int32_t roofline;
+    int32_t sweep;
+} bench_option_t;
+
+typedef struct {
+    const convert_test_vector_t *vector;
+    int32_t width;
+    int32_t height;
+    size_t src_len;
+    size_t dst_len;
+    size_t src_offset;          /* bytes past a BENCH_ALIGNMENT boundary */
+    size_t dst_offset;
+    int32_t flush;              /* evicts both frames from the caches before every run */
+} bench_frame_t;
+
+typedef struct {
+    int32_t width;
+    int32_t height;
+} bench_resolution_t;
+
+typedef struct {
+    size_t src;
+    size_t dst;
+} bench_offset_t;
+
+typedef struct {
+    const char *name;
+    pixctrl_fmt_t fmt;
+} bench_format_t;
+
+typedef struct {
+    const bench_frame_t *frame;
+    const bench_option_t *option;
+    bench_kernel_t kernel;
+    pthread_barrier_t *barrier;
+    uint8_t *src_base;
+    uint8_t *dst_base;
+    uint8_t *src;
+    uint8_t *dst;
+    size_t *samples;            /* written by the first worker only */
+    bench_counter_t *counter;   /* counted on the first worker only, NULL without -p */
+    uint64_t sink;              /* keeps the streaming read alive */
+    pixctrl_result_t result;
+} bench_worker_t;
+
+static const bench_table_t gsc_bench_table[] = {
+    { "rgb2rgb", get_rgb2rgb_test_vector, },
+    { "rgb2yuv", get_rgb2yuv_test_vector, },
+    { "yuv2yuv", get_yuv2yuv_test_vector, },
+};
+
+/* format names of the conversion tables */
+static const bench_format_t gsc_bench_format[] = {
+    { "rgba",    PIXCTRL_FMT_RGBA32,  },
+    { "bgra",    PIXCTRL_FMT_BGRA32,  },
+    { "argb",    PIXCTRL_FMT_ARGB32,  },
+    { "abgr",    PIXCTRL_FMT_ABGR32,  },
+    { "rgb24",   PIXCTRL_FMT_RGB24,   },
+    { "bgr24",   PIXCTRL_FMT_BGR24,   },
+    { "yuv444",  PIXCTRL_FMT_YUV444,  },
+    { "yuv444p", PIXCTRL_FMT_YUV444P, },
+    { "yuyv422", PIXCTRL_FMT_YUYV422, },
+    { "yvyu422", PIXCTRL_FMT_YVYU422, },
+    { "uyvy422", PIXCTRL_FMT_UYVY422, },
+    { "vyuy422", PIXCTRL_FMT_VYUY422, },
+    { "yuv422p", PIXCTRL_FMT_YUV422P, },
+    { "nv12",    PIXCTRL_FMT_NV12,    },
+    { "nv21",    PIXCTRL_FMT_NV21,    },
+    { "yuv420p", PIXCTRL_FMT_YUV420P, },
+    { "gray8",   PIXCTRL_FMT_GRAY8,   },
+};
+
+/* QVGA to 8K, with a non-multiple-of-16 and odd sizes in between */
+static const bench_resolution_t gsc_sweep_resolution[] = {
+    {  320,  240, },
+    {  640,  480, },
+    {  719,  405, },
+    { 1280,  720, },
+    { 1366,  768, },
+    { 1920, 1080, },
+    { 1921, 1081, },
+    { 2560, 1440, },
+    { 3840, 2160, },
+    { 7680, 4320, },
+};
+
+static const bench_offset_t gsc_sweep_offset[] = {
+    {  0,  0, },
+    {  1,  3, },
+    {  7,  7, },
+    { 16, 32, },
+    { 33, 17, },
+    { 63, 63, },
+};
+
+static void print_usage(const char *prog)
+{
+    printf("usage: %s [-f filter] [-s WIDTHxHEIGHT] [-t threads] [-w warmups] [-n repetitions] [-p] [-r] [-c]\n", prog);
+    puts("  -f  run only converters whose name (e.g. 'yuv2yuv/nv12_to_yuv420p') contains 'filter'");
+    puts("  -s  resolution, the table resolution with its resource image when omitted");
+    puts("  -t  number of threads, each one converting its own frame at the same time");
+    printf("  -w  untimed runs before measuring (default %d)\n", DEFAULT_WARMUPS);
+    printf("  -n  timed runs (default %d)\n", DEFAULT_REPETITIONS);
+    puts("  -p  read cycles, instructions, L1D/LLC/dTLB misses through perf_event_open as well");
+    puts("  -r  run every converter at L1, L2, LLC and DRAM sized frames instead of one resolution");
+    puts("  -c  sweep resolutions (-s keeps one), buffer offsets and warm/flushed caches, printed as CSV");
+}
+
+static int32_t parse_option(int32_t argc, char *argv[], bench_option_t *option)
+{
+    int32_t ret = 0;
+    int opt;
+
+    option->filter = NULL;
+    option->width = 0;
+    option->height = 0;
+    option->threads = 1;
+    option->warmups = DEFAULT_WARMUPS;
+    option->repetitions = DEFAULT_REPETITIONS;
+    option->counters = 0;
+    option->roofline = 0;
+    option->sweep = 0;
+
+    while ((ret == 0) && ((opt = getopt(argc, argv, "f:s:t:w:n:prch")) != -1))
+    {
+        switch (opt) {
+        case 'f':
+            option->filter = optarg;
+            break;
+        case 's':
+            if ((sscanf(optarg, "%dx%d", &option->width, &option->height) != 2) ||
+                (option->width <= 0) || (option->height <= 0))
+            {
+                ret = -1;
+            }
+            break;
+        case 't':
+            option->threads = atoi(optarg);
+            ret = (option->threads > 0) ? 0 : -1;
+            break;
+        case 'w':
+            option->warmups = atoi(optarg);
+            ret = (option->warmups >= 0) ? 0 : -1;
+            break;
+        case 'n':
+            option->repetitions = atoi(optarg);
+            ret = (option->repetitions > 0) ? 0 : -1;
+            break;
+        case 'p':
+            option->counters = 1;
+            break;
+        case 'r':
+            option->roofline = 1;
+            break;
+        case 'c':
+            option->sweep = 1;
+            break;
+        default:
+            ret = -1;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+static int compare_samples(const void *lhs, const void *rhs)
+{
+    size_t l = *(const size_t *)lhs, r = *(const size_t *)rhs;
+
+    return (l > r) - (l < r);
+}
+
+static pixctrl_result_t run_kernel(bench_worker_t *worker)
+{
+    const bench_frame_t *frame = worker->frame;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    const uint64_t *words;
+    uint64_t sum = 0U;
+    size_t i;
+
+    switch (worker->kernel) {
+    case BENCH_KERNEL_CONVERT:
+        result = frame->vector->entry(worker->src, worker->dst, frame->width, frame->height);
+        break;
+    case BENCH_KERNEL_MEMCPY:
+        (void)memcpy(worker->dst, worker->src, (frame->src_len + frame->dst_len) / 2);
+        break;
+    case BENCH_KERNEL_STREAM:
+        words = (const uint64_t *)worker->src;
+        for (i = 0; i < (frame->src_len / sizeof(uint64_t)); ++i)
+        {
+            sum += words[i];
+        }
+        (void)memset(worker->dst, (int)(sum & 0xFFU), frame->dst_len);
+        worker->sink += sum;
+        break;
+    default:
+        result = PIXCTRL_NOT_SUPPORT;
+        break;
+    }
+
+    return result;
+}
+
+static void flush_cache(const uint8_t *buf, size_t len)
+{
+    size_t i;
+
+#if defined(__x86_64__) || defined(__i386__)
+    for (i = 0; i < len; i += BENCH_ALIGNMENT)
+    {
+        _mm_clflush(buf + i);
+    }
+    _mm_mfence();
+#elif defined(__aarch64__)
+    for (i = 0; i < len; i += BENCH_ALIGNMENT)
+    {
+        __asm__ volatile("dc civac, %0" : : "r"(buf + i) : "memory");
+    }
+    __asm__ volatile("dsb ish" : : : "memory");
+#else
+    /* no cache maintenance available, flushed runs stay warm */
+    (void)buf;
+    (void)len;
+    (void)i;
+#endif
+}
+
+static void *run_worker(void *arg)
+{
+    bench_worker_t *worker = (bench_worker_t *)arg;
+    const bench_option_t *option = worker->option;
+    int32_t i, runs = option->warmups + option->repetitions;
+    test_timestamp_t start, end;
+    pixctrl_result_t result;
+
+    worker->result = PIXCTRL_SUCCESS;
+    for (i = 0; i < runs; ++i)
+    {
+        if (worker->frame->flush != 0)
+        {
+            flush_cache(worker->src, worker->frame->src_len);
+            flush_cache(worker->dst, worker->frame->dst_len);
+        }
+
+        /* every thread starts a run together, so the first one times the slowest of them */
+        (void)pthread_barrier_wait(worker->barrier);
+        get_timestamp(&start);
+
+        if ((worker->counter != NULL) && (i >= option->warmups))
+        {
+            start_bench_counter(worker->counter);
+            result = run_kernel(worker);
+            stop_bench_counter(worker->counter);
+        }
+        else
+        {
+            result = run_kernel(worker);
+        }
+        if (result != PIXCTRL_SUCCESS)
+        {
+            worker->result = result;
+        }
+
+        (void)pthread_barrier_wait(worker->barrier);
+        get_timestamp(&end);
+
+        if ((worker->samples != NULL) && (i >= option->warmups))
+        {
+            worker->samples[i - option->warmups] = get_elapsed_nsec(&start, &end);
+        }
+    }
+
+    return NULL;
+}
+
+/* bytes of a frame in the layout the converters use, so odd sizes count their ceil-sized chroma */
+static size_t get_frame_len(const char *fmt, size_t bpp, int32_t width, int32_t height)
+{
+    size_t len = 0U;
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(gsc_bench_format) / sizeof(bench_format_t)); ++i)
+    {
+        if (strcmp(fmt, gsc_bench_format[i].name) == 0)
+        {
+            len = pixctrl_get_image_size(gsc_bench_format[i].fmt, width, height);
+            break;
+        }
+    }
+
+    if (len == 0U)
+    {
+        len = (((size_t)width * bpp) / 8) * (size_t)height;
+    }
+
+    return len;
+}
+
+/* fills 'len' bytes of 'src', the first 'src_len' with the source frame */
+static void fill_source(const char *dirpath, const convert_test_vector_t *vector,
+                        int32_t width, int32_t height, uint8_t *src, size_t src_len, size_t len)
+{
+    char resource_path[MAX_PATH_LEN];
+    uint8_t *resource = NULL;
+    size_t resource_len, i;
+
+    if ((width == vector->width) && (height == vector->height))
+    {
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw",
+                                     dirpath, vector->src_group, vector->src_fmt, width, height);
+        resource = load_rawdata(resource_path, &resource_len);
+        if ((resource != NULL) && (resource_len != src_len))
+        {
+            free(resource);
+            resource = NULL;
+        }
+    }
+
+    if (resource != NULL)
+    {
+        (void)memcpy(src, resource, src_len);
+        (void)memset(src + src_len, 0, len - src_len);
+        free(resource);
+    }
+    else
+    {
+        /* no resource at this resolution, the converters are timed on a fixed pseudo-random pattern */
+        for (i = 0; i < len; ++i)
+        {
+            src[i] = (uint8_t)((i * 2654435761U) >> 24);
+        }
+    }
+}
+
+static uint8_t *create_buffer(size_t len)
+{
+    void *buf = NULL;
+
+    /* room for any offset below BENCH_ALIGNMENT */
+    if (posix_memalign(&buf, BENCH_ALIGNMENT, len + BENCH_ALIGNMENT) != 0)
+    {
+        buf = NULL;
+    }
+    assert(buf != NULL);
+
+    return (uint8_t *)buf;
+}
+
+/* 'pixels' is the number of pixels the first worker converted during the timed runs */
+static void print_counter(bench_counter_t *counter, double pixels)
+{
+    uint64_t cycles, instructions, misses;
+    int32_t has_cycles, has_instructions, id;
+
+    has_cycles = (read_bench_counter(counter, BENCH_COUNTER_CYCLES, &cycles) == 0);
+    has_instructions = (read_bench_counter(counter, BENCH_COUNTER_INSTRUCTIONS, &instructions) == 0);
+
+    if (has_cycles)
+    {
+        printf(" %8.2f", (double)cycles / pixels);
+    }
+    else
+    {
+        printf(" %8s", "-");
+    }
+
+    if (has_cycles && has_instructions && (cycles != 0U))
+    {
+        printf(" %6.2f", (double)instructions / (double)cycles);
+    }
+    else
+    {
+        printf(" %6s", "-");
+    }
+
+    for (id = BENCH_COUNTER_L1D_MISSES; id < MAX_OF_BENCH_COUNTER; ++id)
+    {
+        if (read_bench_counter(counter, (bench_counter_id_t)id, &misses) == 0)
+        {
+            printf(" %9.2f", (double)misses * 1e3 / pixels);
+        }
+        else
+        {
+            printf(" %9s", "-");
+        }
+    }
+}
+
+/* the sorted timed runs of one kernel land in 'samples' */
+static pixctrl_result_t measure_kernel(const char *dirpath, const bench_frame_t *frame, const bench_option_t *option,
+                                       bench_kernel_t kernel, bench_counter_t *counter, size_t *samples)
+{
+    /* the baselines may move more bytes than one of the frame buffers holds */
+    size_t len = (frame->src_len > frame->dst_len) ? frame->src_len : frame->dst_len;
+    bench_worker_t *workers;
+    pthread_t *tids;
+    pthread_barrier_t barrier;
+    pixctrl_result_t result = PIXCTRL_SUCCESS;
+    int32_t i;
+
+    workers = (bench_worker_t *)calloc((size_t)option->threads, sizeof(bench_worker_t));
+    tids = (pthread_t *)calloc((size_t)option->threads, sizeof(pthread_t));
+    assert((workers != NULL) && (tids != NULL));
+
+    (void)pthread_barrier_init(&barrier, NULL, (unsigned)option->threads);
+    for (i = 0; i < option->threads; ++i)
+    {
+        workers[i].frame = frame;
+        workers[i].option = option;
+        workers[i].kernel = kernel;
+        workers[i].barrier = &barrier;
+        workers[i].src_base = create_buffer(len);
+        workers[i].dst_base = create_buffer(len);
+        workers[i].src = workers[i].src_base + frame->src_offset;
+        workers[i].dst = workers[i].dst_base + frame->dst_offset;
+        fill_source(dirpath, frame->vector, frame->width, frame->height, workers[i].src, frame->src_len, len);
+        (void)memset(workers[i].dst, 0, len);
+        workers[i].samples = (i == 0) ? samples : NULL;
+        /* the first worker runs on this thread, which is the one the counters follow */
+        workers[i].counter = (i == 0) ? counter : NULL;
+    }
+
+    for (i = 1; i < option->threads; ++i)
+    {
+        (void)pthread_create(&tids[i], NULL, run_worker, &workers[i]);
+    }
+    (void)run_worker(&workers[0]);
+
+    for (i = 0; i < option->threads; ++i)
+    {
+        if (i != 0)
+        {
+            (void)pthread_join(tids[i], NULL);
+        }
+        if (workers[i].result != PIXCTRL_SUCCESS)
+        {
+            result = workers[i].result;
+        }
+        free(workers[i].src_base);
+        free(workers[i].dst_base);
+    }
+    (void)pthread_barrier_destroy(&barrier);
+
+    qsort(samples, (size_t)option->repetitions, sizeof(size_t), compare_samples);
+
+    free(workers);
+    free(tids);
+
+    return result;
+}
+
+static void bench_vector(const char *dirpath, const char *name, const char *level,
+                         const convert_test_vector_t *vector, const bench_option_t *option,
+                         int32_t width, int32_t height)
+{
+    bench_frame_t frame;
+    size_t *samples, *memcpy_samples, *stream_samples, min, median, p99;
+    bench_counter_t counter;
+    int32_t has_counter = 0;
+    pixctrl_result_t result;
+    double pixels, bytes;
+
+    frame.vector = vector;
+    frame.width = width;
+    frame.height = height;
+    frame.src_len = get_frame_len(vector->src_fmt, vector->src_bpp, width, height);
+    frame.dst_len = get_frame_len(vector->dst_fmt, vector->dst_bpp, width, height);
+    frame.src_offset = 0U;
+    frame.dst_offset = 0U;
+    frame.flush = 0;
+
+    samples = (size_t *)malloc(sizeof(size_t) * (size_t)option->repetitions);
+    memcpy_samples = (size_t *)malloc(sizeof(size_t) * (size_t)option->repetitions);
+    stream_samples = (size_t *)malloc(sizeof(size_t) * (size_t)option->repetitions);
+    assert((samples != NULL) && (memcpy_samples != NULL) && (stream_samples != NULL));
+
+    if ((option->counters != 0) && (open_bench_counter(&counter) > 0))
+    {
+        has_counter = 1;
+    }
+
+    result = measure_kernel(dirpath, &frame, option, BENCH_KERNEL_CONVERT,
+                            (has_counter != 0) ? &counter : NULL, samples);
+
+    printf("%-36s %5dx%-5d ", name, width, height);
+    if (level != NULL)
+    {
+        printf("%-5s ", level);
+    }
+    printf("%3d ", option->threads);
+    if (result == PIXCTRL_SUCCESS)
+    {
+        (void)measure_kernel(dirpath, &frame, option, BENCH_KERNEL_MEMCPY, NULL, memcpy_samples);
+        (void)measure_kernel(dirpath, &frame, option, BENCH_KERNEL_STREAM, NULL, stream_samples);
+
+        min = samples[0];
+        median = samples[option->repetitions / 2];
+        p99 = samples[((option->repetitions * 99) + 99) / 100 - 1];
+
+        pixels = (double)width * (double)height * (double)option->threads;
+        bytes = (double)(frame.src_len + frame.dst_len) * (double)option->threads;
+
+        /* the baselines move the same bytes, so the ratio of the medians is the ratio of the bandwidths */
+        printf("%10.3f %10.3f %10.3f %10.1f %8.2f %8.1f %8.1f",
+               (double)min / 1e3, (double)median / 1e3, (double)p99 / 1e3,
+               pixels * 1e3 / (double)median, bytes / (double)median,
+               (double)memcpy_samples[option->repetitions / 2] * 100.0 / (double)median,
+               (double)stream_samples[option->repetitions / 2] * 100.0 / (double)median);
+        if (has_counter != 0)
+        {
+            print_counter(&counter, (double)width * (double)height * (double)option->repetitions);
+        }
+        putchar('\n');
+    }
+    else
+    {
+        puts("not supported at this resolution");
+    }
+
+    if (has_counter != 0)
+    {
+        close_bench_counter(&counter);
+    }
+
+    free(samples);
+    free(memcpy_samples);
+    free(stream_samples);
+}
+
+static void sweep_vector(const char *dirpath, const char *name, const convert_test_vector_t *vector,
+                         const bench_option_t *option)
+{
+    static const char *cache_name[2] = { "warm", "flushed", };
+    int32_t r, o, resolutions = (int32_t)(sizeof(gsc_sweep_resolution) / sizeof(bench_resolution_t));
+    int32_t offsets = (int32_t)(sizeof(gsc_sweep_offset) / sizeof(bench_offset_t));
+    bench_resolution_t resolution;
+    bench_frame_t frame;
+    size_t *samples, median;
+    pixctrl_result_t result;
+
+    samples = (size_t *)malloc(sizeof(size_t) * (size_t)option->repetitions);
+    assert(samples != NULL);
+
+    for (r = 0; r < resolutions; ++r)
+    {
+        resolution = gsc_sweep_resolution[r];
+        if (option->width != 0)
+        {
+            /* a fixed resolution still sweeps the offsets and the cache state */
+            if (r != 0)
+            {
+                break;
+            }
+            resolution.width = option->width;
+            resolution.height = option->height;
+        }
+
+        frame.vector = vector;
+        frame.width = resolution.width;
+        frame.height = resolution.height;
+        frame.src_len = get_frame_len(vector->src_fmt, vector->src_bpp, frame.width, frame.height);
+        frame.dst_len = get_frame_len(vector->dst_fmt, vector->dst_bpp, frame.width, frame.height);
+
+        for (o = 0; o < offsets; ++o)
+        {
+            frame.src_offset = gsc_sweep_offset[o].src;
+            frame.dst_offset = gsc_sweep_offset[o].dst;
+
+            for (frame.flush = 0; frame.flush < 2; ++frame.flush)
+            {
+                result = measure_kernel(dirpath, &frame, option, BENCH_KERNEL_CONVERT, NULL, samples);
+
+                printf("%s,%d,%d,%zu,%zu,%s,%d,", name, frame.width, frame.height,
+                       frame.src_offset, frame.dst_offset, cache_name[frame.flush], option->threads);
+                if (result == PIXCTRL_SUCCESS)
+                {
+                    median = samples[option->repetitions / 2];
+                    printf("%zu,%zu,%zu,%.1f,%.3f,ok\n",
+                           samples[0], median, samples[((option->repetitions * 99) + 99) / 100 - 1],
+                           (double)frame.width * (double)frame.height * (double)option->threads * 1e3 / (double)median,
+                           (double)(frame.src_len + frame.dst_len) * (double)option->threads / (double)median);
+                }
+                else
+                {
+                    printf(",,,,,error %d\n", (int32_t)result);
+                }
+                (void)fflush(stdout);
+            }
+        }
+    }
+
+    free(samples);
+}
+
+static size_t get_cache_size(bench_level_t level)
+{
+    /* fallbacks for a typical desktop core when the C library cannot tell */
+    static const size_t fallback[MAX_OF_BENCH_LEVEL - 1] = { 32U * 1024U, 1024U * 1024U, 32U * 1024U * 1024U, };
+    size_t size;
+    long value = 0;
+
+    if (level == BENCH_LEVEL_DRAM)
+    {
+        /* well past the last level cache */
+        size = 4U * get_cache_size(BENCH_LEVEL_LLC);
+    }
+    else
+    {
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+        switch (level) {
+        case BENCH_LEVEL_L1:
+            value = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+            break;
+        case BENCH_LEVEL_L2:
+            value = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            break;
+        default:
+            value = sysconf(_SC_LEVEL3_CACHE_SIZE);
+            break;
+        }
+#endif
+        size = (value > 0) ? (size_t)value : fallback[level];
+    }
+
+    return size;
+}
+
+/* picks a 16:9 like frame whose source and destination together take half of the cache at 'level' */
+static void get_level_resolution(const convert_test_vector_t *vector, bench_level_t level,
+                                 int32_t *width, int32_t *height)
+{
+    size_t budget = (level == BENCH_LEVEL_DRAM) ? get_cache_size(level) : (get_cache_size(level) / 2);
+    double pixels = ((double)budget * 8.0) / (double)(vector->src_bpp + vector->dst_bpp);
+    double side = sqrt(pixels * 16.0 / 9.0);
+    int32_t w, h;
+
+    w = ((int32_t)side) & ~15;
+    w = (w < 16) ? 16 : w;
+    h = ((int32_t)(pixels / (double)w)) & ~1;
+    h = (h < 2) ? 2 : h;
+
+    *width = w;
+    *height = h;
+}
+
+int32_t main(int32_t argc, char *argv[])
+{
+    static const char *level_name[MAX_OF_BENCH_LEVEL] = { "L1", "L2", "LLC", "DRAM", };
+    int32_t ret = 0;
+    char *dirpath = get_dirpath(argv[0]);
+    char name[MAX_FILENAME];
+    bench_option_t option;
+    bench_counter_t counter;
+    const convert_test_vector_t *vectors;
+    int32_t t, i, level, test_vectors, width, height;
+
+    if ((dirpath != NULL) && (parse_option(argc, argv, &option) == 0))
+    {
+        /* containers usually deny perf_event_open, then only the wall time is reported */
+        if (option.counters != 0)
+        {
+            if (open_bench_counter(&counter) == 0)
+            {
+                puts("hardware counters are unavailable, reporting wall time only");
+                option.counters = 0;
+            }
+            close_bench_counter(&counter);
+        }
+
+        if (option.sweep != 0)
+        {
+            puts("converter,width,height,src_offset,dst_offset,cache,threads,min_ns,median_ns,p99_ns,mpix_per_s,gb_per_s,result");
+        }
+        else
+        {
+            printf("%-36s %-11s ", "converter", "resolution");
+            if (option.roofline != 0)
+            {
+                printf("%-5s ", "level");
+            }
+            printf("%3s %10s %10s %10s %10s %8s %8s %8s",
+                   "thr", "min[us]", "median[us]", "p99[us]", "MPix/s", "GB/s", "%memcpy", "%stream");
+            if (option.counters != 0)
+            {
+                printf(" %8s %6s %9s %9s %9s", "cyc/px", "IPC", "L1D/kpx", "LLC/kpx", "dTLB/kpx");
+            }
+            putchar('\n');
+        }
+
+        for (t = 0; t < (int32_t)(sizeof(gsc_bench_table) / sizeof(bench_table_t)); ++t)
+        {
+            vectors = gsc_bench_table[t].get_vector(&test_vectors);
+            for (i = 0; i < test_vectors; ++i)
+            {
+                (void)snprintf(name, sizeof(name), "%s/%s_to_%s",
+                               gsc_bench_table[t].name, vectors[i].src_fmt, vectors[i].dst_fmt);
+                if ((option.filter != NULL) && (strstr(name, option.filter) == NULL))
+                {
+                    continue;
+                }
+
+                if (option.sweep != 0)
+                {
+                    sweep_vector(dirpath, name, &vectors[i], &option);
+                }
+                else if (option.roofline != 0)
+                {
+                    for (level = 0; level < MAX_OF_BENCH_LEVEL; ++level)
+                    {
+                        get_level_resolution(&vectors[i], (bench_level_t)level, &width, &height);
+                        bench_vector(dirpath, name, level_name[level], &vectors[i], &option, width, height);
+                    }
+                }
+                else
+                {
+                    width = (option.width != 0) ? option.width : vectors[i].width;
+                    height = (option.height != 0) ? option.height : vectors[i].height;
+                    bench_vector(dirpath, name, NULL, &vectors[i], &option, width, height);
+                }
+            }
+        }
+    }
+    else
+    {
+        print_usage(argv[0]);
+        ret = -1;
+    }
+
+    return ret;
+}
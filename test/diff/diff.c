@@ -0,0 +1,1129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "pixctrl.h"
+#include "diff.h"
+
+#define DIFF_FILL               (0xA5)      /* initial destination bytes, the same on both sides */
+#define DIFF_MAX_PLANES         (3)
+#define DIFF_MAX_CUTS           (3)         /* dirty rectangles per axis */
+#define DIFF_MAX_EXTRA          (4)         /* alignment units a roi frame is wider/taller than the roi */
+#define DIFF_CHANGE_FRAMES      (3)
+#define DIFF_COUNT(table)       ((int32_t)(sizeof(table) / sizeof((table)[0])))
+
+typedef struct {
+    const char *name;
+    int32_t bytes;                  /* per sample */
+    int32_t sub_x;                  /* pixels per sample */
+    int32_t sub_y;
+} diff_plane_t;
+
+typedef struct {
+    pixctrl_fmt_t fmt;
+    int32_t planes;
+    diff_plane_t plane[DIFF_MAX_PLANES];
+} diff_layout_t;
+
+/* chroma planes are ceil-sized and packed 4:2:2 rows are whole macro-pixels, as the converters write them */
+static const diff_layout_t gsc_diff_layout[] = {
+    { PIXCTRL_FMT_RGBA32,  1, { { "packed", 4, 1, 1, }, }, },
+    { PIXCTRL_FMT_BGRA32,  1, { { "packed", 4, 1, 1, }, }, },
+    { PIXCTRL_FMT_ARGB32,  1, { { "packed", 4, 1, 1, }, }, },
+    { PIXCTRL_FMT_ABGR32,  1, { { "packed", 4, 1, 1, }, }, },
+    { PIXCTRL_FMT_BGR24,   1, { { "packed", 3, 1, 1, }, }, },
+    { PIXCTRL_FMT_RGB24,   1, { { "packed", 3, 1, 1, }, }, },
+    { PIXCTRL_FMT_YUV444,  1, { { "packed", 3, 1, 1, }, }, },
+    { PIXCTRL_FMT_YUV444P, 3, { { "Y", 1, 1, 1, }, { "U", 1, 1, 1, }, { "V", 1, 1, 1, }, }, },
+    { PIXCTRL_FMT_YUYV422, 1, { { "packed", 4, 2, 1, }, }, },
+    { PIXCTRL_FMT_YVYU422, 1, { { "packed", 4, 2, 1, }, }, },
+    { PIXCTRL_FMT_UYVY422, 1, { { "packed", 4, 2, 1, }, }, },
+    { PIXCTRL_FMT_VYUY422, 1, { { "packed", 4, 2, 1, }, }, },
+    { PIXCTRL_FMT_YUV422P, 3, { { "Y", 1, 1, 1, }, { "U", 1, 2, 1, }, { "V", 1, 2, 1, }, }, },
+    { PIXCTRL_FMT_NV12,    2, { { "Y", 1, 1, 1, }, { "UV", 2, 2, 2, }, }, },
+    { PIXCTRL_FMT_NV21,    2, { { "Y", 1, 1, 1, }, { "VU", 2, 2, 2, }, }, },
+    { PIXCTRL_FMT_YUV420P, 3, { { "Y", 1, 1, 1, }, { "U", 1, 2, 2, }, { "V", 1, 2, 2, }, }, },
+    { PIXCTRL_FMT_GRAY8,   1, { { "Y", 1, 1, 1, }, }, },
+};
+
+/* motion outputs, one sample per PIXCTRL_MOTION_BLOCK square, and the luma statistics as plain bytes */
+static const diff_layout_t gsc_sad_layout = { PIXCTRL_FMT_GRAY8, 1, { { "sad", 4, PIXCTRL_MOTION_BLOCK, PIXCTRL_MOTION_BLOCK, }, }, };
+static const diff_layout_t gsc_map_layout = { PIXCTRL_FMT_GRAY8, 1, { { "map", 1, PIXCTRL_MOTION_BLOCK, PIXCTRL_MOTION_BLOCK, }, }, };
+static const diff_layout_t gsc_stats_layout = { PIXCTRL_FMT_GRAY8, 1, { { "bytes", 1, 1, 1, }, }, };
+
+static const diff_pair_t gsc_convert_pair[] = {
+    { "rgba_to_rgb24",       PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_RGB24,   pixctrl_generic_rgba_to_rgb24, },
+    { "rgba_to_bgr24",       PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_BGR24,   pixctrl_generic_rgba_to_bgr24, },
+    { "bgra_to_rgb24",       PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_RGB24,   pixctrl_generic_bgra_to_rgb24, },
+    { "bgra_to_bgr24",       PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_BGR24,   pixctrl_generic_bgra_to_bgr24, },
+    { "argb_to_rgb24",       PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_RGB24,   pixctrl_generic_argb_to_rgb24, },
+    { "argb_to_bgr24",       PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_BGR24,   pixctrl_generic_argb_to_bgr24, },
+    { "abgr_to_rgb24",       PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_RGB24,   pixctrl_generic_abgr_to_rgb24, },
+    { "abgr_to_bgr24",       PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_BGR24,   pixctrl_generic_abgr_to_bgr24, },
+    { "rgba_to_bgra",        PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_BGRA32,  pixctrl_generic_rgba_to_bgra, },
+    { "bgra_to_rgba",        PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_RGBA32,  pixctrl_generic_bgra_to_rgba, },
+    { "rgba_to_abgr",        PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_ABGR32,  pixctrl_generic_rgba_to_abgr, },
+    { "bgra_to_argb",        PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_ARGB32,  pixctrl_generic_bgra_to_argb, },
+    { "argb_to_bgra",        PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_BGRA32,  pixctrl_generic_argb_to_bgra, },
+    { "abgr_to_rgba",        PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_RGBA32,  pixctrl_generic_abgr_to_rgba, },
+    { "argb_to_abgr",        PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_ABGR32,  pixctrl_generic_argb_to_abgr, },
+    { "abgr_to_argb",        PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_ARGB32,  pixctrl_generic_abgr_to_argb, },
+    { "rgb24_to_bgr24",      PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_BGR24,   pixctrl_generic_rgb24_to_bgr24, },
+    { "bgr24_to_rgb24",      PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_RGB24,   pixctrl_generic_bgr24_to_rgb24, },
+    { "rgb24_to_yuv444",     PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YUV444,  pixctrl_generic_rgb24_to_yuv444, },
+    { "bgr24_to_yuv444",     PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YUV444,  pixctrl_generic_bgr24_to_yuv444, },
+    { "argb_to_yuv444",      PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YUV444,  pixctrl_generic_argb_to_yuv444, },
+    { "abgr_to_yuv444",      PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YUV444,  pixctrl_generic_abgr_to_yuv444, },
+    { "rgba_to_yuv444",      PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YUV444,  pixctrl_generic_rgba_to_yuv444, },
+    { "bgra_to_yuv444",      PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YUV444,  pixctrl_generic_bgra_to_yuv444, },
+    { "rgb24_to_yuyv422",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YUYV422, pixctrl_generic_rgb24_to_yuyv422, },
+    { "bgr24_to_yuyv422",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YUYV422, pixctrl_generic_bgr24_to_yuyv422, },
+    { "argb_to_yuyv422",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YUYV422, pixctrl_generic_argb_to_yuyv422, },
+    { "abgr_to_yuyv422",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YUYV422, pixctrl_generic_abgr_to_yuyv422, },
+    { "rgba_to_yuyv422",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YUYV422, pixctrl_generic_rgba_to_yuyv422, },
+    { "bgra_to_yuyv422",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YUYV422, pixctrl_generic_bgra_to_yuyv422, },
+    { "rgb24_to_yvyu422",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YVYU422, pixctrl_generic_rgb24_to_yvyu422, },
+    { "bgr24_to_yvyu422",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YVYU422, pixctrl_generic_bgr24_to_yvyu422, },
+    { "argb_to_yvyu422",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YVYU422, pixctrl_generic_argb_to_yvyu422, },
+    { "abgr_to_yvyu422",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YVYU422, pixctrl_generic_abgr_to_yvyu422, },
+    { "rgba_to_yvyu422",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YVYU422, pixctrl_generic_rgba_to_yvyu422, },
+    { "bgra_to_yvyu422",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YVYU422, pixctrl_generic_bgra_to_yvyu422, },
+    { "rgb24_to_uyvy422",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_UYVY422, pixctrl_generic_rgb24_to_uyvy422, },
+    { "bgr24_to_uyvy422",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_UYVY422, pixctrl_generic_bgr24_to_uyvy422, },
+    { "argb_to_uyvy422",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_UYVY422, pixctrl_generic_argb_to_uyvy422, },
+    { "abgr_to_uyvy422",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_UYVY422, pixctrl_generic_abgr_to_uyvy422, },
+    { "rgba_to_uyvy422",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_UYVY422, pixctrl_generic_rgba_to_uyvy422, },
+    { "bgra_to_uyvy422",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_UYVY422, pixctrl_generic_bgra_to_uyvy422, },
+    { "rgb24_to_vyuy422",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_VYUY422, pixctrl_generic_rgb24_to_vyuy422, },
+    { "bgr24_to_vyuy422",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_VYUY422, pixctrl_generic_bgr24_to_vyuy422, },
+    { "argb_to_vyuy422",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_VYUY422, pixctrl_generic_argb_to_vyuy422, },
+    { "abgr_to_vyuy422",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_VYUY422, pixctrl_generic_abgr_to_vyuy422, },
+    { "rgba_to_vyuy422",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_VYUY422, pixctrl_generic_rgba_to_vyuy422, },
+    { "bgra_to_vyuy422",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_VYUY422, pixctrl_generic_bgra_to_vyuy422, },
+    { "rgb24_to_nv12",       PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_NV12,    pixctrl_generic_rgb24_to_nv12, },
+    { "bgr24_to_nv12",       PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_NV12,    pixctrl_generic_bgr24_to_nv12, },
+    { "argb_to_nv12",        PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_NV12,    pixctrl_generic_argb_to_nv12, },
+    { "abgr_to_nv12",        PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_NV12,    pixctrl_generic_abgr_to_nv12, },
+    { "rgba_to_nv12",        PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_NV12,    pixctrl_generic_rgba_to_nv12, },
+    { "bgra_to_nv12",        PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_NV12,    pixctrl_generic_bgra_to_nv12, },
+    { "rgb24_to_nv21",       PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_NV21,    pixctrl_generic_rgb24_to_nv21, },
+    { "bgr24_to_nv21",       PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_NV21,    pixctrl_generic_bgr24_to_nv21, },
+    { "argb_to_nv21",        PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_NV21,    pixctrl_generic_argb_to_nv21, },
+    { "abgr_to_nv21",        PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_NV21,    pixctrl_generic_abgr_to_nv21, },
+    { "rgba_to_nv21",        PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_NV21,    pixctrl_generic_rgba_to_nv21, },
+    { "bgra_to_nv21",        PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_NV21,    pixctrl_generic_bgra_to_nv21, },
+    { "rgb24_to_yuv444p",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YUV444P, pixctrl_generic_rgb24_to_yuv444p, },
+    { "bgr24_to_yuv444p",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YUV444P, pixctrl_generic_bgr24_to_yuv444p, },
+    { "argb_to_yuv444p",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YUV444P, pixctrl_generic_argb_to_yuv444p, },
+    { "abgr_to_yuv444p",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YUV444P, pixctrl_generic_abgr_to_yuv444p, },
+    { "rgba_to_yuv444p",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YUV444P, pixctrl_generic_rgba_to_yuv444p, },
+    { "bgra_to_yuv444p",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YUV444P, pixctrl_generic_bgra_to_yuv444p, },
+    { "rgb24_to_yuv422p",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YUV422P, pixctrl_generic_rgb24_to_yuv422p, },
+    { "bgr24_to_yuv422p",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YUV422P, pixctrl_generic_bgr24_to_yuv422p, },
+    { "argb_to_yuv422p",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YUV422P, pixctrl_generic_argb_to_yuv422p, },
+    { "abgr_to_yuv422p",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YUV422P, pixctrl_generic_abgr_to_yuv422p, },
+    { "rgba_to_yuv422p",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YUV422P, pixctrl_generic_rgba_to_yuv422p, },
+    { "bgra_to_yuv422p",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YUV422P, pixctrl_generic_bgra_to_yuv422p, },
+    { "rgb24_to_yuv420p",    PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_YUV420P, pixctrl_generic_rgb24_to_yuv420p, },
+    { "bgr24_to_yuv420p",    PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_YUV420P, pixctrl_generic_bgr24_to_yuv420p, },
+    { "argb_to_yuv420p",     PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_YUV420P, pixctrl_generic_argb_to_yuv420p, },
+    { "abgr_to_yuv420p",     PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_YUV420P, pixctrl_generic_abgr_to_yuv420p, },
+    { "rgba_to_yuv420p",     PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_YUV420P, pixctrl_generic_rgba_to_yuv420p, },
+    { "bgra_to_yuv420p",     PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_YUV420P, pixctrl_generic_bgra_to_yuv420p, },
+    { "rgb24_to_gray8",      PIXCTRL_FMT_RGB24,   PIXCTRL_FMT_GRAY8,   pixctrl_generic_rgb24_to_gray8, },
+    { "bgr24_to_gray8",      PIXCTRL_FMT_BGR24,   PIXCTRL_FMT_GRAY8,   pixctrl_generic_bgr24_to_gray8, },
+    { "argb_to_gray8",       PIXCTRL_FMT_ARGB32,  PIXCTRL_FMT_GRAY8,   pixctrl_generic_argb_to_gray8, },
+    { "abgr_to_gray8",       PIXCTRL_FMT_ABGR32,  PIXCTRL_FMT_GRAY8,   pixctrl_generic_abgr_to_gray8, },
+    { "rgba_to_gray8",       PIXCTRL_FMT_RGBA32,  PIXCTRL_FMT_GRAY8,   pixctrl_generic_rgba_to_gray8, },
+    { "bgra_to_gray8",       PIXCTRL_FMT_BGRA32,  PIXCTRL_FMT_GRAY8,   pixctrl_generic_bgra_to_gray8, },
+    { "yuv444_to_yuyv422",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_YUYV422, pixctrl_generic_yuv444_to_yuyv422, },
+    { "yuv444_to_yvyu422",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_YVYU422, pixctrl_generic_yuv444_to_yvyu422, },
+    { "yuv444_to_uyvy422",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_UYVY422, pixctrl_generic_yuv444_to_uyvy422, },
+    { "yuv444_to_vyuy422",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_VYUY422, pixctrl_generic_yuv444_to_vyuy422, },
+    { "yuv444_to_nv12",      PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_NV12,    pixctrl_generic_yuv444_to_nv12, },
+    { "yuv444_to_nv21",      PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_NV21,    pixctrl_generic_yuv444_to_nv21, },
+    { "yuyv422_to_yuv444",   PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_YUV444,  pixctrl_generic_yuyv422_to_yuv444, },
+    { "yvyu422_to_yuv444",   PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_YUV444,  pixctrl_generic_yvyu422_to_yuv444, },
+    { "uyvy422_to_yuv444",   PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_YUV444,  pixctrl_generic_uyvy422_to_yuv444, },
+    { "vyuy422_to_yuv444",   PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_YUV444,  pixctrl_generic_vyuy422_to_yuv444, },
+    { "yuyv422_to_nv12",     PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_NV12,    pixctrl_generic_yuyv422_to_nv12, },
+    { "yvyu422_to_nv12",     PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_NV12,    pixctrl_generic_yvyu422_to_nv12, },
+    { "uyvy422_to_nv12",     PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_NV12,    pixctrl_generic_uyvy422_to_nv12, },
+    { "vyuy422_to_nv12",     PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_NV12,    pixctrl_generic_vyuy422_to_nv12, },
+    { "yuyv422_to_nv21",     PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_NV21,    pixctrl_generic_yuyv422_to_nv21, },
+    { "yvyu422_to_nv21",     PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_NV21,    pixctrl_generic_yvyu422_to_nv21, },
+    { "uyvy422_to_nv21",     PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_NV21,    pixctrl_generic_uyvy422_to_nv21, },
+    { "vyuy422_to_nv21",     PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_NV21,    pixctrl_generic_vyuy422_to_nv21, },
+    { "nv12_to_yuv444",      PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YUV444,  pixctrl_generic_nv12_to_yuv444, },
+    { "nv21_to_yuv444",      PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YUV444,  pixctrl_generic_nv21_to_yuv444, },
+    { "nv12_to_yuyv422",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YUYV422, pixctrl_generic_nv12_to_yuyv422, },
+    { "nv12_to_yvyu422",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YVYU422, pixctrl_generic_nv12_to_yvyu422, },
+    { "nv12_to_uyvy422",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_UYVY422, pixctrl_generic_nv12_to_uyvy422, },
+    { "nv12_to_vyuy422",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_VYUY422, pixctrl_generic_nv12_to_vyuy422, },
+    { "nv21_to_yuyv422",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YUYV422, pixctrl_generic_nv21_to_yuyv422, },
+    { "nv21_to_yvyu422",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YVYU422, pixctrl_generic_nv21_to_yvyu422, },
+    { "nv21_to_uyvy422",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_UYVY422, pixctrl_generic_nv21_to_uyvy422, },
+    { "nv21_to_vyuy422",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_VYUY422, pixctrl_generic_nv21_to_vyuy422, },
+    { "nv12_to_nv21",        PIXCTRL_FMT_NV12,    PIXCTRL_FMT_NV21,    pixctrl_generic_nv12_to_nv21, },
+    { "nv21_to_nv12",        PIXCTRL_FMT_NV21,    PIXCTRL_FMT_NV12,    pixctrl_generic_nv21_to_nv12, },
+    { "yuv444_to_yuv444p",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_YUV444P, pixctrl_generic_yuv444_to_yuv444p, },
+    { "yuv444_to_yuv422p",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_YUV422P, pixctrl_generic_yuv444_to_yuv422p, },
+    { "yuv444_to_yuv420p",   PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_YUV420P, pixctrl_generic_yuv444_to_yuv420p, },
+    { "yuyv422_to_yuv444p",  PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_YUV444P, pixctrl_generic_yuyv422_to_yuv444p, },
+    { "yvyu422_to_yuv444p",  PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_YUV444P, pixctrl_generic_yvyu422_to_yuv444p, },
+    { "uyvy422_to_yuv444p",  PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_YUV444P, pixctrl_generic_uyvy422_to_yuv444p, },
+    { "vyuy422_to_yuv444p",  PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_YUV444P, pixctrl_generic_vyuy422_to_yuv444p, },
+    { "yuyv422_to_yuv422p",  PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_YUV422P, pixctrl_generic_yuyv422_to_yuv422p, },
+    { "yvyu422_to_yuv422p",  PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_YUV422P, pixctrl_generic_yvyu422_to_yuv422p, },
+    { "uyvy422_to_yuv422p",  PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_YUV422P, pixctrl_generic_uyvy422_to_yuv422p, },
+    { "vyuy422_to_yuv422p",  PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_YUV422P, pixctrl_generic_vyuy422_to_yuv422p, },
+    { "yuyv422_to_yuv420p",  PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_YUV420P, pixctrl_generic_yuyv422_to_yuv420p, },
+    { "yvyu422_to_yuv420p",  PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_YUV420P, pixctrl_generic_yvyu422_to_yuv420p, },
+    { "uyvy422_to_yuv420p",  PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_YUV420P, pixctrl_generic_uyvy422_to_yuv420p, },
+    { "vyuy422_to_yuv420p",  PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_YUV420P, pixctrl_generic_vyuy422_to_yuv420p, },
+    { "nv12_to_yuv444p",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YUV444P, pixctrl_generic_nv12_to_yuv444p, },
+    { "nv21_to_yuv444p",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YUV444P, pixctrl_generic_nv21_to_yuv444p, },
+    { "nv12_to_yuv422p",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YUV422P, pixctrl_generic_nv12_to_yuv422p, },
+    { "nv21_to_yuv422p",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YUV422P, pixctrl_generic_nv21_to_yuv422p, },
+    { "nv12_to_yuv420p",     PIXCTRL_FMT_NV12,    PIXCTRL_FMT_YUV420P, pixctrl_generic_nv12_to_yuv420p, },
+    { "nv21_to_yuv420p",     PIXCTRL_FMT_NV21,    PIXCTRL_FMT_YUV420P, pixctrl_generic_nv21_to_yuv420p, },
+    { "yuv444p_to_yuv444",   PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YUV444,  pixctrl_generic_yuv444p_to_yuv444, },
+    { "yuv444p_to_yuyv422",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YUYV422, pixctrl_generic_yuv444p_to_yuyv422, },
+    { "yuv444p_to_yvyu422",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YVYU422, pixctrl_generic_yuv444p_to_yvyu422, },
+    { "yuv444p_to_uyvy422",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_UYVY422, pixctrl_generic_yuv444p_to_uyvy422, },
+    { "yuv444p_to_vyuy422",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_VYUY422, pixctrl_generic_yuv444p_to_vyuy422, },
+    { "yuv444p_to_nv12",     PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_NV12,    pixctrl_generic_yuv444p_to_nv12, },
+    { "yuv444p_to_nv21",     PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_NV21,    pixctrl_generic_yuv444p_to_nv21, },
+    { "yuv422p_to_yuv444",   PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YUV444,  pixctrl_generic_yuv422p_to_yuv444, },
+    { "yuv422p_to_yuyv422",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YUYV422, pixctrl_generic_yuv422p_to_yuyv422, },
+    { "yuv422p_to_yvyu422",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YVYU422, pixctrl_generic_yuv422p_to_yvyu422, },
+    { "yuv422p_to_uyvy422",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_UYVY422, pixctrl_generic_yuv422p_to_uyvy422, },
+    { "yuv422p_to_vyuy422",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_VYUY422, pixctrl_generic_yuv422p_to_vyuy422, },
+    { "yuv422p_to_nv12",     PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_NV12,    pixctrl_generic_yuv422p_to_nv12, },
+    { "yuv422p_to_nv21",     PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_NV21,    pixctrl_generic_yuv422p_to_nv21, },
+    { "yuv420p_to_yuv444",   PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YUV444,  pixctrl_generic_yuv420p_to_yuv444, },
+    { "yuv420p_to_yuyv422",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YUYV422, pixctrl_generic_yuv420p_to_yuyv422, },
+    { "yuv420p_to_yvyu422",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YVYU422, pixctrl_generic_yuv420p_to_yvyu422, },
+    { "yuv420p_to_uyvy422",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_UYVY422, pixctrl_generic_yuv420p_to_uyvy422, },
+    { "yuv420p_to_vyuy422",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_VYUY422, pixctrl_generic_yuv420p_to_vyuy422, },
+    { "yuv420p_to_nv12",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_NV12,    pixctrl_generic_yuv420p_to_nv12, },
+    { "yuv420p_to_nv21",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_NV21,    pixctrl_generic_yuv420p_to_nv21, },
+    { "yuv444p_to_yuv422p",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YUV422P, pixctrl_generic_yuv444p_to_yuv422p, },
+    { "yuv444p_to_yuv420p",  PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YUV420P, pixctrl_generic_yuv444p_to_yuv420p, },
+    { "yuv422p_to_yuv444p",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YUV444P, pixctrl_generic_yuv422p_to_yuv444p, },
+    { "yuv422p_to_yuv420p",  PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YUV420P, pixctrl_generic_yuv422p_to_yuv420p, },
+    { "yuv420p_to_yuv444p",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YUV444P, pixctrl_generic_yuv420p_to_yuv444p, },
+    { "yuv420p_to_yuv422p",  PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YUV422P, pixctrl_generic_yuv420p_to_yuv422p, },
+    { "yuv444_to_gray8",     PIXCTRL_FMT_YUV444,  PIXCTRL_FMT_GRAY8,   pixctrl_generic_yuv444_to_gray8, },
+    { "yuyv422_to_gray8",    PIXCTRL_FMT_YUYV422, PIXCTRL_FMT_GRAY8,   pixctrl_generic_yuyv422_to_gray8, },
+    { "yvyu422_to_gray8",    PIXCTRL_FMT_YVYU422, PIXCTRL_FMT_GRAY8,   pixctrl_generic_yvyu422_to_gray8, },
+    { "uyvy422_to_gray8",    PIXCTRL_FMT_UYVY422, PIXCTRL_FMT_GRAY8,   pixctrl_generic_uyvy422_to_gray8, },
+    { "vyuy422_to_gray8",    PIXCTRL_FMT_VYUY422, PIXCTRL_FMT_GRAY8,   pixctrl_generic_vyuy422_to_gray8, },
+    { "nv12_to_gray8",       PIXCTRL_FMT_NV12,    PIXCTRL_FMT_GRAY8,   pixctrl_generic_nv12_to_gray8, },
+    { "nv21_to_gray8",       PIXCTRL_FMT_NV21,    PIXCTRL_FMT_GRAY8,   pixctrl_generic_nv21_to_gray8, },
+    { "yuv444p_to_gray8",    PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_GRAY8,   pixctrl_generic_yuv444p_to_gray8, },
+    { "yuv422p_to_gray8",    PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_GRAY8,   pixctrl_generic_yuv422p_to_gray8, },
+    { "yuv420p_to_gray8",    PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_GRAY8,   pixctrl_generic_yuv420p_to_gray8, },
+    { "nv12_to_rgb24",       PIXCTRL_FMT_NV12,    PIXCTRL_FMT_RGB24,   pixctrl_generic_nv12_to_rgb24, },
+    { "nv12_to_bgr24",       PIXCTRL_FMT_NV12,    PIXCTRL_FMT_BGR24,   pixctrl_generic_nv12_to_bgr24, },
+    { "nv12_to_argb",        PIXCTRL_FMT_NV12,    PIXCTRL_FMT_ARGB32,  pixctrl_generic_nv12_to_argb, },
+    { "nv12_to_abgr",        PIXCTRL_FMT_NV12,    PIXCTRL_FMT_ABGR32,  pixctrl_generic_nv12_to_abgr, },
+    { "nv12_to_rgba",        PIXCTRL_FMT_NV12,    PIXCTRL_FMT_RGBA32,  pixctrl_generic_nv12_to_rgba, },
+    { "nv12_to_bgra",        PIXCTRL_FMT_NV12,    PIXCTRL_FMT_BGRA32,  pixctrl_generic_nv12_to_bgra, },
+    { "nv21_to_rgb24",       PIXCTRL_FMT_NV21,    PIXCTRL_FMT_RGB24,   pixctrl_generic_nv21_to_rgb24, },
+    { "nv21_to_bgr24",       PIXCTRL_FMT_NV21,    PIXCTRL_FMT_BGR24,   pixctrl_generic_nv21_to_bgr24, },
+    { "nv21_to_argb",        PIXCTRL_FMT_NV21,    PIXCTRL_FMT_ARGB32,  pixctrl_generic_nv21_to_argb, },
+    { "nv21_to_abgr",        PIXCTRL_FMT_NV21,    PIXCTRL_FMT_ABGR32,  pixctrl_generic_nv21_to_abgr, },
+    { "nv21_to_rgba",        PIXCTRL_FMT_NV21,    PIXCTRL_FMT_RGBA32,  pixctrl_generic_nv21_to_rgba, },
+    { "nv21_to_bgra",        PIXCTRL_FMT_NV21,    PIXCTRL_FMT_BGRA32,  pixctrl_generic_nv21_to_bgra, },
+    { "yuv420p_to_rgb24",    PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_RGB24,   pixctrl_generic_yuv420p_to_rgb24, },
+    { "yuv420p_to_bgr24",    PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_BGR24,   pixctrl_generic_yuv420p_to_bgr24, },
+    { "yuv420p_to_argb",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_ARGB32,  pixctrl_generic_yuv420p_to_argb, },
+    { "yuv420p_to_abgr",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_ABGR32,  pixctrl_generic_yuv420p_to_abgr, },
+    { "yuv420p_to_rgba",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_RGBA32,  pixctrl_generic_yuv420p_to_rgba, },
+    { "yuv420p_to_bgra",     PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_BGRA32,  pixctrl_generic_yuv420p_to_bgra, },
+};
+
+/* 'Y' plane (or gray8 image) formats of the motion kernels */
+static const diff_pair_t gsc_motion_pair[] = {
+    { "gray8",   PIXCTRL_FMT_GRAY8,   PIXCTRL_FMT_GRAY8,   NULL, },
+    { "nv12",    PIXCTRL_FMT_NV12,    PIXCTRL_FMT_NV12,    NULL, },
+    { "nv21",    PIXCTRL_FMT_NV21,    PIXCTRL_FMT_NV21,    NULL, },
+    { "yuv420p", PIXCTRL_FMT_YUV420P, PIXCTRL_FMT_YUV420P, NULL, },
+    { "yuv422p", PIXCTRL_FMT_YUV422P, PIXCTRL_FMT_YUV422P, NULL, },
+    { "yuv444p", PIXCTRL_FMT_YUV444P, PIXCTRL_FMT_YUV444P, NULL, },
+};
+
+/********************************************************************************************
+ *  Random
+ ********************************************************************************************
+ */
+void init_diff_random(diff_random_t *random, uint64_t seed)
+{
+    random->state = (seed != 0U) ? seed : 0x9E3779B97F4A7C15U;
+}
+
+/* uniform enough in [0, range), 0 for an empty range */
+uint32_t get_diff_random(diff_random_t *random, uint32_t range)
+{
+    uint64_t x = random->state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    random->state = x;
+
+    return (range != 0U) ? (uint32_t)(((x * 2685821657736338717U) >> 32) % range) : 0U;
+}
+
+static int32_t get_random_int(diff_random_t *random, int32_t range)
+{
+    return (int32_t)get_diff_random(random, (range > 0) ? (uint32_t)range : 0U);
+}
+
+/********************************************************************************************
+ *  Frame
+ ********************************************************************************************
+ */
+static const diff_layout_t *get_layout(pixctrl_fmt_t fmt)
+{
+    const diff_layout_t *layout = NULL;
+    int32_t i;
+
+    for (i = 0; i < (int32_t)(sizeof(gsc_diff_layout) / sizeof(diff_layout_t)); ++i)
+    {
+        if (gsc_diff_layout[i].fmt == fmt)
+        {
+            layout = &gsc_diff_layout[i];
+        }
+    }
+
+    return layout;
+}
+
+static size_t get_plane_stride(const diff_plane_t *plane, int32_t width)
+{
+    return (size_t)((width + plane->sub_x - 1) / plane->sub_x) * (size_t)plane->bytes;
+}
+
+static size_t get_plane_rows(const diff_plane_t *plane, int32_t height)
+{
+    return (size_t)((height + plane->sub_y - 1) / plane->sub_y);
+}
+
+static size_t get_plane_offset(const diff_layout_t *layout, int32_t index, int32_t width, int32_t height)
+{
+    size_t offset = 0U;
+    int32_t i;
+
+    for (i = 0; i < index; ++i)
+    {
+        offset += get_plane_stride(&layout->plane[i], width) * get_plane_rows(&layout->plane[i], height);
+    }
+
+    return offset;
+}
+
+static size_t get_frame_len(const diff_layout_t *layout, int32_t width, int32_t height)
+{
+    return get_plane_offset(layout, layout->planes, width, height);
+}
+
+/* exactly 'len' bytes, so the address sanitizer catches a write past the frame */
+static uint8_t *create_frame(size_t len, int32_t fill)
+{
+    uint8_t *buf = (uint8_t *)malloc((len != 0U) ? len : 1U);
+
+    assert(buf != NULL);
+    (void)memset(buf, fill, len);
+
+    return buf;
+}
+
+static void fill_content(diff_param_t *param, uint8_t *buf, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i)
+    {
+        buf[i] = (param->content != NULL) ? param->content[i % param->content_len]
+                                          : (uint8_t)get_diff_random(&param->random, 256U);
+    }
+}
+
+/* copies the 'width' x 'height' region at ('src_x', 'src_y') to ('dst_x', 'dst_y'), offsets are multiples of the subsampling */
+static void copy_region(const diff_layout_t *layout,
+                        const uint8_t *src, int32_t src_width, int32_t src_height, int32_t src_x, int32_t src_y,
+                        uint8_t *dst, int32_t dst_width, int32_t dst_height, int32_t dst_x, int32_t dst_y,
+                        int32_t width, int32_t height)
+{
+    const diff_plane_t *plane;
+    const uint8_t *src_row;
+    uint8_t *dst_row;
+    size_t src_stride, dst_stride, len, rows, row;
+    int32_t i;
+
+    for (i = 0; i < layout->planes; ++i)
+    {
+        plane = &layout->plane[i];
+        src_stride = get_plane_stride(plane, src_width);
+        dst_stride = get_plane_stride(plane, dst_width);
+        len = get_plane_stride(plane, width);
+        rows = get_plane_rows(plane, height);
+        src_row = src + get_plane_offset(layout, i, src_width, src_height) +
+                  ((size_t)(src_y / plane->sub_y) * src_stride) + ((size_t)(src_x / plane->sub_x) * (size_t)plane->bytes);
+        dst_row = dst + get_plane_offset(layout, i, dst_width, dst_height) +
+                  ((size_t)(dst_y / plane->sub_y) * dst_stride) + ((size_t)(dst_x / plane->sub_x) * (size_t)plane->bytes);
+        for (row = 0U; row < rows; ++row)
+        {
+            (void)memcpy(dst_row, src_row, len);
+            src_row += src_stride;
+            dst_row += dst_stride;
+        }
+    }
+}
+
+/* fills 'mismatch' with the first differing byte in plane order */
+static diff_result_t compare_frame(const diff_layout_t *layout, int32_t width, int32_t height, const char *what,
+                                   const uint8_t *expected, const uint8_t *actual, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_MATCH;
+    const diff_plane_t *plane;
+    size_t offset, stride, len, i;
+    int32_t p;
+
+    for (p = 0; (result == DIFF_RESULT_MATCH) && (p < layout->planes); ++p)
+    {
+        plane = &layout->plane[p];
+        offset = get_plane_offset(layout, p, width, height);
+        stride = get_plane_stride(plane, width);
+        len = stride * get_plane_rows(plane, height);
+        if (memcmp(&expected[offset], &actual[offset], len) != 0)
+        {
+            i = 0U;
+            while (expected[offset + i] == actual[offset + i])
+            {
+                ++i;
+            }
+            mismatch->what = what;
+            mismatch->plane = plane->name;
+            mismatch->x = (int32_t)((i % stride) / (size_t)plane->bytes);
+            mismatch->y = (int32_t)(i / stride);
+            mismatch->byte = (int32_t)((i % stride) % (size_t)plane->bytes);
+            mismatch->expected = expected[offset + i];
+            mismatch->actual = actual[offset + i];
+            mismatch->width = width;
+            mismatch->height = height;
+            mismatch->threads = 0;
+            result = DIFF_RESULT_MISMATCH;
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Region of Interest Backend
+ ********************************************************************************************
+ */
+/* the roi is cut out of a wider and taller source and written into a wider and taller destination,
+ * which walks both frames with strides that differ from the roi width */
+static diff_result_t run_roi(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    int32_t src_align_x = 1, src_align_y = 1, dst_align_x = 1, dst_align_y = 1, align_x, align_y;
+    int32_t width, height, src_width, src_height, dst_width, dst_height, dst_x, dst_y;
+    pixctrl_rect_t rect;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *crop, *roi, *expected, *actual;
+
+    (void)pixctrl_get_format_alignment(pair->src_fmt, &src_align_x, &src_align_y);
+    (void)pixctrl_get_format_alignment(pair->dst_fmt, &dst_align_x, &dst_align_y);
+    align_x = (src_align_x > dst_align_x) ? src_align_x : dst_align_x;
+    align_y = (src_align_y > dst_align_y) ? src_align_y : dst_align_y;
+
+    width = (param->width >= align_x) ? (param->width - (param->width % align_x)) : align_x;
+    height = (param->height >= align_y) ? (param->height - (param->height % align_y)) : align_y;
+    src_width = width + (align_x * get_random_int(&param->random, DIFF_MAX_EXTRA));
+    src_height = height + (align_y * get_random_int(&param->random, DIFF_MAX_EXTRA));
+    dst_width = width + (align_x * get_random_int(&param->random, DIFF_MAX_EXTRA));
+    dst_height = height + (align_y * get_random_int(&param->random, DIFF_MAX_EXTRA));
+    rect.x = align_x * get_random_int(&param->random, ((src_width - width) / align_x) + 1);
+    rect.y = align_y * get_random_int(&param->random, ((src_height - height) / align_y) + 1);
+    rect.width = width;
+    rect.height = height;
+    dst_x = align_x * get_random_int(&param->random, ((dst_width - width) / align_x) + 1);
+    dst_y = align_y * get_random_int(&param->random, ((dst_height - height) / align_y) + 1);
+
+    src = create_frame(get_frame_len(src_layout, src_width, src_height), 0);
+    crop = create_frame(get_frame_len(src_layout, width, height), 0);
+    roi = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+    expected = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, src_width, src_height));
+    copy_region(src_layout, src, src_width, src_height, rect.x, rect.y, crop, width, height, 0, 0, width, height);
+    ref = pair->reference(crop, roi, width, height);
+    cand = pixctrl_generic_convert_roi(pair->src_fmt, src, src_width, src_height, &rect,
+                                       pair->dst_fmt, actual, dst_width, dst_height, dst_x, dst_y);
+    if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+    {
+        /* whole destination, so a write outside the roi is a mismatch too */
+        copy_region(dst_layout, roi, width, height, 0, 0, expected, dst_width, dst_height, dst_x, dst_y, width, height);
+        result = compare_frame(dst_layout, dst_width, dst_height, "dst", expected, actual, mismatch);
+    }
+
+    free(src);
+    free(crop);
+    free(roi);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Dirty Rectangle Backend
+ ********************************************************************************************
+ */
+/* fills 'cut' with 'cuts' + 1 ascending positions from 0 to 'len' */
+static void get_random_cuts(diff_random_t *random, int32_t len, int32_t cuts, int32_t *cut)
+{
+    int32_t i;
+
+    cut[0] = 0;
+    for (i = 1; i < cuts; ++i)
+    {
+        cut[i] = cut[i - 1] + get_random_int(random, (len - cut[i - 1]) + 1);
+    }
+    cut[cuts] = len;
+}
+
+/* a random grid of rectangles covering the frame, converted in random order */
+static diff_result_t run_dirty_rect(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    pixctrl_rect_t rects[DIFF_MAX_CUTS * DIFF_MAX_CUTS], swap;
+    int32_t x_cut[DIFF_MAX_CUTS + 1], y_cut[DIFF_MAX_CUTS + 1];
+    int32_t cols, rows, col, row, count = 0, i, j;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *expected, *actual;
+
+    cols = 1 + get_random_int(&param->random, DIFF_MAX_CUTS);
+    rows = 1 + get_random_int(&param->random, DIFF_MAX_CUTS);
+    get_random_cuts(&param->random, width, cols, x_cut);
+    get_random_cuts(&param->random, height, rows, y_cut);
+    for (row = 0; row < rows; ++row)
+    {
+        for (col = 0; col < cols; ++col)
+        {
+            rects[count].x = x_cut[col];
+            rects[count].y = y_cut[row];
+            rects[count].width = x_cut[col + 1] - x_cut[col];
+            rects[count].height = y_cut[row + 1] - y_cut[row];
+            ++count;
+        }
+    }
+    for (i = count - 1; i > 0; --i)
+    {
+        j = get_random_int(&param->random, i + 1);
+        swap = rects[i];
+        rects[i] = rects[j];
+        rects[j] = swap;
+    }
+
+    src = create_frame(get_frame_len(src_layout, width, height), 0);
+    expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, width, height));
+    ref = pair->reference(src, expected, width, height);
+    cand = pixctrl_generic_convert_dirty_rects(pair->src_fmt, src, width, height, pair->dst_fmt, actual, rects, count);
+    if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+    {
+        result = compare_frame(dst_layout, width, height, "dst", expected, actual, mismatch);
+    }
+
+    free(src);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Change Detection Backend
+ ********************************************************************************************
+ */
+/* a whole first frame, then frames with a few random source bytes changed, each against a full conversion */
+static diff_result_t run_change_detect(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const int32_t tile_size = 2 * (1 + get_random_int(&param->random, 16));
+    const size_t src_len = get_frame_len(src_layout, width, height);
+    pixctrl_change_detect_t *detect = NULL;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *expected, *actual;
+    int32_t frame, changes, i;
+
+    if (pixctrl_generic_change_detect_create(pair->src_fmt, width, height, pair->dst_fmt, tile_size, &detect) == PIXCTRL_SUCCESS)
+    {
+        src = create_frame(src_len, 0);
+        expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+        actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+        fill_content(param, src, src_len);
+        result = DIFF_RESULT_MATCH;
+        for (frame = 0; (result == DIFF_RESULT_MATCH) && (frame < DIFF_CHANGE_FRAMES); ++frame)
+        {
+            changes = (frame == 0) ? 0 : get_random_int(&param->random, 8);
+            for (i = 0; i < changes; ++i)
+            {
+                src[get_diff_random(&param->random, (uint32_t)src_len)] ^= (uint8_t)(1U + get_diff_random(&param->random, 255U));
+            }
+
+            ref = pair->reference(src, expected, width, height);
+            cand = pixctrl_generic_change_detect_convert(detect, src, actual, NULL, NULL);
+            if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+            {
+                result = compare_frame(dst_layout, width, height, "dst", expected, actual, mismatch);
+            }
+            else
+            {
+                result = DIFF_RESULT_SKIPPED;
+            }
+        }
+
+        free(src);
+        free(expected);
+        free(actual);
+        pixctrl_generic_change_detect_destroy(detect);
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  'Y' Plane Passthrough Backend
+ ********************************************************************************************
+ */
+static diff_result_t run_y_passthrough(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch,
+                                       pixctrl_y_plane_mode_t y_mode)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const size_t y_len = (size_t)width * (size_t)height;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *expected, *actual;
+
+    src = create_frame(get_frame_len(src_layout, width, height), 0);
+    expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, width, height));
+    ref = pair->reference(src, expected, width, height);
+    if (y_mode == PIXCTRL_Y_PLANE_ALIAS)
+    {
+        /* only the chroma is written, the source 'Y' plane completes the frame */
+        cand = pixctrl_generic_yuv_to_yuv_y_passthrough(pair->src_fmt, src, width, height,
+                                                        pair->dst_fmt, actual + y_len, y_mode);
+        if (cand == PIXCTRL_SUCCESS)
+        {
+            (void)memcpy(actual, src, y_len);
+        }
+    }
+    else
+    {
+        cand = pixctrl_generic_yuv_to_yuv_y_passthrough(pair->src_fmt, src, width, height,
+                                                        pair->dst_fmt, actual, y_mode);
+    }
+    if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+    {
+        result = compare_frame(dst_layout, width, height, "dst", expected, actual, mismatch);
+    }
+
+    free(src);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+static diff_result_t run_y_copy(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    return run_y_passthrough(pair, param, mismatch, PIXCTRL_Y_PLANE_COPY);
+}
+
+static diff_result_t run_y_row_copy(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    return run_y_passthrough(pair, param, mismatch, PIXCTRL_Y_PLANE_ROW_COPY);
+}
+
+static diff_result_t run_y_alias(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    return run_y_passthrough(pair, param, mismatch, PIXCTRL_Y_PLANE_ALIAS);
+}
+
+/********************************************************************************************
+ *  Luma Statistics Backend
+ ********************************************************************************************
+ */
+/* the fused statistics against a separate pass over the reference 'Y' plane */
+static diff_result_t run_luma_stats(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const int32_t zones_x = 1 + get_random_int(&param->random, (width < PIXCTRL_LUMA_STATS_MAX_ZONES) ? width : PIXCTRL_LUMA_STATS_MAX_ZONES);
+    const int32_t zones_y = 1 + get_random_int(&param->random, (height < PIXCTRL_LUMA_STATS_MAX_ZONES) ? height : PIXCTRL_LUMA_STATS_MAX_ZONES);
+    pixctrl_luma_stats_t expected_stats, actual_stats;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *expected, *actual;
+
+    src = create_frame(get_frame_len(src_layout, width, height), 0);
+    expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, width, height));
+    (void)pixctrl_luma_stats_init(&expected_stats, width, height, zones_x, zones_y);
+    (void)pixctrl_luma_stats_init(&actual_stats, width, height, zones_x, zones_y);
+    ref = pair->reference(src, expected, width, height);
+    cand = pixctrl_generic_convert_with_luma_stats(pair->src_fmt, src, width, height, pair->dst_fmt, actual, &actual_stats);
+    if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+    {
+        /* 'Y' leads every destination format of the fused converter */
+        (void)pixctrl_generic_luma_stats(expected, &expected_stats);
+        (void)pixctrl_luma_stats_finish(&expected_stats);
+        (void)pixctrl_luma_stats_finish(&actual_stats);
+        result = compare_frame(dst_layout, width, height, "dst", expected, actual, mismatch);
+        if (result == DIFF_RESULT_MATCH)
+        {
+            result = compare_frame(&gsc_stats_layout, (int32_t)sizeof(pixctrl_luma_stats_t), 1, "stats",
+                                   (const uint8_t *)&expected_stats, (const uint8_t *)&actual_stats, mismatch);
+            mismatch->width = width;
+            mismatch->height = height;
+        }
+    }
+
+    free(src);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Fused Resize and Convert Backend
+ ********************************************************************************************
+ */
+static const pixctrl_resize_method_t gsc_resize_method[] = {
+    PIXCTRL_RESIZE_NEAREST_NEIGHBOR, PIXCTRL_RESIZE_BILINEAR, PIXCTRL_RESIZE_BICUBIC,
+};
+
+/* pixctrl_generic_resize_convert() against pixctrl_generic_resize() followed by the reference converter,
+ * both from the same context, to a random size with a random method */
+static diff_result_t run_resize_convert(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const int32_t dst_width = 1 + get_random_int(&param->random, width * 2);
+    const int32_t dst_height = 1 + get_random_int(&param->random, height * 2);
+    const pixctrl_resize_method_t method = gsc_resize_method[get_random_int(&param->random, DIFF_COUNT(gsc_resize_method))];
+    pixctrl_resize_t *resize = NULL;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *scaled, *expected, *actual;
+
+    src = create_frame(get_frame_len(src_layout, width, height), 0);
+    scaled = create_frame(get_frame_len(src_layout, dst_width, dst_height), DIFF_FILL);
+    expected = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, width, height));
+    ref = pixctrl_generic_resize_create(pair->src_fmt, method, width, height, dst_width, dst_height, &resize);
+    if (ref == PIXCTRL_SUCCESS)
+    {
+        ref = pixctrl_generic_resize(resize, src, scaled);
+        if (ref == PIXCTRL_SUCCESS)
+        {
+            ref = pair->reference(scaled, expected, dst_width, dst_height);
+        }
+        cand = pixctrl_generic_resize_convert(resize, src, pair->dst_fmt, actual);
+        if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+        {
+            result = compare_frame(dst_layout, dst_width, dst_height, "dst", expected, actual, mismatch);
+        }
+        pixctrl_generic_resize_destroy(resize);
+    }
+
+    free(src);
+    free(scaled);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Fused Rotate and Convert Backend
+ ********************************************************************************************
+ */
+static const pixctrl_rotate_t gsc_rotate[] = {
+    PIXCTRL_ROTATE_0, PIXCTRL_ROTATE_90, PIXCTRL_ROTATE_180, PIXCTRL_ROTATE_270,
+};
+
+/* pixctrl_generic_rotate_convert() against pixctrl_generic_rotate() followed by the reference converter */
+static diff_result_t run_rotate_convert(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *src_layout = get_layout(pair->src_fmt), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const pixctrl_rotate_t rotate = gsc_rotate[get_random_int(&param->random, DIFF_COUNT(gsc_rotate))];
+    const int32_t quarter = ((rotate == PIXCTRL_ROTATE_90) || (rotate == PIXCTRL_ROTATE_270)) ? 1 : 0;
+    const int32_t dst_width = (quarter != 0) ? height : width;
+    const int32_t dst_height = (quarter != 0) ? width : height;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *rotated, *expected, *actual;
+
+    src = create_frame(get_frame_len(src_layout, width, height), 0);
+    rotated = create_frame(get_frame_len(src_layout, dst_width, dst_height), DIFF_FILL);
+    expected = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+    actual = create_frame(get_frame_len(dst_layout, dst_width, dst_height), DIFF_FILL);
+
+    fill_content(param, src, get_frame_len(src_layout, width, height));
+    ref = pixctrl_generic_rotate(pair->src_fmt, rotate, src, width, height, rotated);
+    if (ref == PIXCTRL_SUCCESS)
+    {
+        ref = pair->reference(rotated, expected, dst_width, dst_height);
+    }
+    cand = pixctrl_generic_rotate_convert(pair->src_fmt, rotate, src, width, height, pair->dst_fmt, actual);
+    if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+    {
+        result = compare_frame(dst_layout, dst_width, dst_height, "dst", expected, actual, mismatch);
+    }
+
+    free(src);
+    free(rotated);
+    free(expected);
+    free(actual);
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Fused Tiled Converter Backend
+ ********************************************************************************************
+ */
+typedef struct {
+    pixctrl_fmt_t tiled_fmt;
+    pixctrl_fmt_t dst_fmt;
+    const char *what;
+    diff_convert_fn_t detile;       /* tiled to linear nv12 */
+    diff_convert_fn_t fused;        /* tiled straight to 'dst_fmt' */
+} diff_tiled_t;
+
+static const diff_tiled_t gsc_tiled[] = {
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_YUV420P, "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_yuv420p, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_RGB24,   "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_rgb24, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_BGR24,   "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_bgr24, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_ARGB32,  "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_argb, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_ABGR32,  "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_abgr, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_RGBA32,  "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_rgba, },
+    { PIXCTRL_FMT_NV12_16X16, PIXCTRL_FMT_BGRA32,  "dst (16x16 tiles)", pixctrl_generic_nv12_16x16_to_nv12, pixctrl_generic_nv12_16x16_to_bgra, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_YUV420P, "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_yuv420p, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_RGB24,   "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_rgb24, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_BGR24,   "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_bgr24, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_ARGB32,  "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_argb, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_ABGR32,  "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_abgr, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_RGBA32,  "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_rgba, },
+    { PIXCTRL_FMT_NV12_64X32, PIXCTRL_FMT_BGRA32,  "dst (64x32 tiles)", pixctrl_generic_nv12_64x32_to_nv12, pixctrl_generic_nv12_64x32_to_bgra, },
+};
+
+/* every fused tiled converter to the destination of a linear nv12 pair against detiling followed by that pair */
+static diff_result_t run_tiled(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *linear_layout = get_layout(PIXCTRL_FMT_NV12), *dst_layout = get_layout(pair->dst_fmt);
+    const int32_t width = param->width, height = param->height;
+    const diff_tiled_t *tiled;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *linear, *expected, *actual;
+    size_t src_len;
+    int32_t i;
+
+    for (i = 0; (pair->src_fmt == PIXCTRL_FMT_NV12) && (result != DIFF_RESULT_MISMATCH) &&
+                (i < DIFF_COUNT(gsc_tiled)); ++i)
+    {
+        tiled = &gsc_tiled[i];
+        if (tiled->dst_fmt == pair->dst_fmt)
+        {
+            /* the padding of the tiles is random too, neither side may read it */
+            src_len = pixctrl_get_image_size(tiled->tiled_fmt, width, height);
+            src = create_frame(src_len, 0);
+            linear = create_frame(get_frame_len(linear_layout, width, height), DIFF_FILL);
+            expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+            actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+            fill_content(param, src, src_len);
+            ref = tiled->detile(src, linear, width, height);
+            if (ref == PIXCTRL_SUCCESS)
+            {
+                ref = pair->reference(linear, expected, width, height);
+            }
+            cand = tiled->fused(src, actual, width, height);
+            if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+            {
+                result = compare_frame(dst_layout, width, height, tiled->what, expected, actual, mismatch);
+            }
+
+            free(src);
+            free(linear);
+            free(expected);
+            free(actual);
+        }
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Fused ISP Backend
+ ********************************************************************************************
+ */
+#define DIFF_ISP_LUT_LEN        (1 << 12)   /* gamma entries of the widest raw */
+
+static const pixctrl_bayer_t gsc_bayer[] = {
+    PIXCTRL_BAYER_RGGB, PIXCTRL_BAYER_BGGR, PIXCTRL_BAYER_GRBG, PIXCTRL_BAYER_GBRG,
+};
+static const pixctrl_raw_t gsc_raw[] = {
+    PIXCTRL_RAW8, PIXCTRL_RAW10, PIXCTRL_RAW12, PIXCTRL_RAW10_MIPI,
+};
+static const pixctrl_demosaic_method_t gsc_demosaic_method[] = {
+    PIXCTRL_DEMOSAIC_BILINEAR, PIXCTRL_DEMOSAIC_EDGE_AWARE,
+};
+
+/* pixctrl_generic_isp() into the destination of an rgb24 pair against the same isp into rgb24 followed by that
+ * pair, with a random raw layout, bayer pattern, method and, on half of the runs, random isp stages */
+static diff_result_t run_isp(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *rgb_layout = get_layout(PIXCTRL_FMT_RGB24), *dst_layout = get_layout(pair->dst_fmt);
+    const pixctrl_bayer_t pattern = gsc_bayer[get_random_int(&param->random, DIFF_COUNT(gsc_bayer))];
+    const pixctrl_raw_t raw = gsc_raw[get_random_int(&param->random, DIFF_COUNT(gsc_raw))];
+    const pixctrl_demosaic_method_t method = gsc_demosaic_method[get_random_int(&param->random, DIFF_COUNT(gsc_demosaic_method))];
+    const int32_t align = (raw == PIXCTRL_RAW10_MIPI) ? 4 : 2;
+    const int32_t width = (param->width >= align) ? (param->width - (param->width % align)) : align;
+    const int32_t height = (param->height >= 2) ? (param->height - (param->height % 2)) : 2;
+    const int32_t bits = (raw == PIXCTRL_RAW8) ? 8 : ((raw == PIXCTRL_RAW12) ? 12 : 10);
+    static uint8_t lut[DIFF_ISP_LUT_LEN];
+    pixctrl_isp_t isp;
+    const pixctrl_isp_t *stages = NULL;
+    pixctrl_result_t ref, cand;
+    uint8_t *src, *rgb, *expected, *actual;
+    size_t src_len;
+    int32_t i;
+
+    if (pair->src_fmt == PIXCTRL_FMT_RGB24)
+    {
+        if (get_random_int(&param->random, 2) != 0)
+        {
+            for (i = 0; i < 3; ++i)
+            {
+                isp.wb_gain[i] = (1 << (PIXCTRL_ISP_Q - 1)) + get_random_int(&param->random, 3 << (PIXCTRL_ISP_Q - 1));
+            }
+            for (i = 0; i < 9; ++i)
+            {
+                isp.ccm[i] = (((i % 4) == 0) ? (1 << PIXCTRL_ISP_Q) : 0) + get_random_int(&param->random, 1 << PIXCTRL_ISP_Q) -
+                             (1 << (PIXCTRL_ISP_Q - 1));
+            }
+            isp.gamma_lut = NULL;
+            if (get_random_int(&param->random, 2) != 0)
+            {
+                (void)pixctrl_generic_isp_gamma_lut(2.2, bits, lut);
+                isp.gamma_lut = lut;
+            }
+            stages = &isp;
+        }
+
+        switch (raw)
+        {
+        case PIXCTRL_RAW8:
+            src_len = (size_t)width * (size_t)height;
+            break;
+        case PIXCTRL_RAW10_MIPI:
+            src_len = (((size_t)width * 5U) / 4U) * (size_t)height;
+            break;
+        default:
+            src_len = (size_t)width * (size_t)height * 2U;
+            break;
+        }
+        src = create_frame(src_len, 0);
+        rgb = create_frame(get_frame_len(rgb_layout, width, height), DIFF_FILL);
+        expected = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+        actual = create_frame(get_frame_len(dst_layout, width, height), DIFF_FILL);
+
+        fill_content(param, src, src_len);
+        ref = pixctrl_generic_isp(stages, pattern, raw, method, src, width, height, PIXCTRL_FMT_RGB24, rgb);
+        if (ref == PIXCTRL_SUCCESS)
+        {
+            ref = pair->reference(rgb, expected, width, height);
+        }
+        cand = pixctrl_generic_isp(stages, pattern, raw, method, src, width, height, pair->dst_fmt, actual);
+        if ((ref == PIXCTRL_SUCCESS) && (cand == PIXCTRL_SUCCESS))
+        {
+            result = compare_frame(dst_layout, width, height, "dst", expected, actual, mismatch);
+        }
+
+        free(src);
+        free(rgb);
+        free(expected);
+        free(actual);
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Motion Backend
+ ********************************************************************************************
+ */
+/* every thread count from 2 to 'threads' against the single threaded run */
+static diff_result_t run_motion(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch)
+{
+    diff_result_t result = DIFF_RESULT_SKIPPED;
+    const diff_layout_t *layout = get_layout(pair->src_fmt), *gray_layout = get_layout(PIXCTRL_FMT_GRAY8);
+    const int32_t width = param->width, height = param->height;
+    const size_t frame_len = get_frame_len(layout, width, height);
+    const size_t gray_len = get_frame_len(gray_layout, width, height);
+    const size_t sad_len = get_frame_len(&gsc_sad_layout, width, height);
+    const size_t map_len = get_frame_len(&gsc_map_layout, width, height);
+    const uint32_t threshold = get_diff_random(&param->random, PIXCTRL_MOTION_BLOCK * PIXCTRL_MOTION_BLOCK * 128U);
+    pixctrl_result_t ref, cand;
+    uint8_t *prev, *curr, *expected[3], *actual[3];
+    int32_t threads, i;
+
+    prev = create_frame(frame_len, 0);
+    curr = create_frame(frame_len, 0);
+    expected[0] = create_frame(gray_len, DIFF_FILL);
+    expected[1] = create_frame(sad_len, DIFF_FILL);
+    expected[2] = create_frame(map_len, DIFF_FILL);
+    actual[0] = create_frame(gray_len, DIFF_FILL);
+    actual[1] = create_frame(sad_len, DIFF_FILL);
+    actual[2] = create_frame(map_len, DIFF_FILL);
+
+    fill_content(param, prev, frame_len);
+    fill_content(param, curr, frame_len);
+    ref = pixctrl_generic_absdiff(pair->src_fmt, prev, curr, width, height, expected[0], 1);
+    if (ref == PIXCTRL_SUCCESS)
+    {
+        ref = pixctrl_generic_block_sad(pair->src_fmt, prev, curr, width, height, (uint32_t *)(void *)expected[1], 1);
+    }
+    if (ref == PIXCTRL_SUCCESS)
+    {
+        ref = pixctrl_generic_motion_map(pair->src_fmt, prev, curr, width, height, threshold, expected[2], 1);
+    }
+
+    for (threads = 2; (ref == PIXCTRL_SUCCESS) && (result != DIFF_RESULT_MISMATCH) && (threads <= param->threads); ++threads)
+    {
+        for (i = 0; i < 3; ++i)
+        {
+            (void)memset(actual[i], DIFF_FILL, (i == 0) ? gray_len : ((i == 1) ? sad_len : map_len));
+        }
+        cand = pixctrl_generic_absdiff(pair->src_fmt, prev, curr, width, height, actual[0], threads);
+        if (cand == PIXCTRL_SUCCESS)
+        {
+            cand = pixctrl_generic_block_sad(pair->src_fmt, prev, curr, width, height, (uint32_t *)(void *)actual[1], threads);
+        }
+        if (cand == PIXCTRL_SUCCESS)
+        {
+            cand = pixctrl_generic_motion_map(pair->src_fmt, prev, curr, width, height, threshold, actual[2], threads);
+        }
+
+        if (cand == PIXCTRL_SUCCESS)
+        {
+            result = compare_frame(gray_layout, width, height, "absdiff", expected[0], actual[0], mismatch);
+            if (result == DIFF_RESULT_MATCH)
+            {
+                result = compare_frame(&gsc_sad_layout, width, height, "block sad", expected[1], actual[1], mismatch);
+            }
+            if (result == DIFF_RESULT_MATCH)
+            {
+                result = compare_frame(&gsc_map_layout, width, height, "motion map", expected[2], actual[2], mismatch);
+            }
+            if (result == DIFF_RESULT_MISMATCH)
+            {
+                mismatch->threads = threads;
+            }
+        }
+    }
+
+    free(prev);
+    free(curr);
+    for (i = 0; i < 3; ++i)
+    {
+        free(expected[i]);
+        free(actual[i]);
+    }
+
+    return result;
+}
+
+/********************************************************************************************
+ *  Backend
+ ********************************************************************************************
+ */
+static const diff_pair_t *get_convert_pairs(int32_t *pairs)
+{
+    *pairs = (int32_t)(sizeof(gsc_convert_pair) / sizeof(diff_pair_t));
+
+    return gsc_convert_pair;
+}
+
+static const diff_pair_t *get_motion_pairs(int32_t *pairs)
+{
+    *pairs = (int32_t)(sizeof(gsc_motion_pair) / sizeof(diff_pair_t));
+
+    return gsc_motion_pair;
+}
+
+/* pairs a backend does not support are skipped, so each one walks the whole table */
+static const diff_backend_t gsc_diff_backend[] = {
+    { "roi",           get_convert_pairs, run_roi,           },
+    { "dirty_rect",    get_convert_pairs, run_dirty_rect,    },
+    { "change_detect", get_convert_pairs, run_change_detect, },
+    { "y_copy",        get_convert_pairs, run_y_copy,        },
+    { "y_row_copy",    get_convert_pairs, run_y_row_copy,    },
+    { "y_alias",       get_convert_pairs, run_y_alias,       },
+    { "luma_stats",    get_convert_pairs, run_luma_stats,    },
+    { "resize_convert", get_convert_pairs, run_resize_convert, },
+    { "rotate_convert", get_convert_pairs, run_rotate_convert, },
+    { "tiled",         get_convert_pairs, run_tiled,         },
+    { "isp",           get_convert_pairs, run_isp,           },
+    { "motion",        get_motion_pairs,  run_motion,        },
+};
+
+const diff_backend_t *get_diff_backends(int32_t *backends)
+{
+    *backends = (int32_t)(sizeof(gsc_diff_backend) / sizeof(diff_backend_t));
+
+    return gsc_diff_backend;
+}
+
+void print_diff_mismatch(const char *backend, const diff_pair_t *pair, const diff_mismatch_t *mismatch)
+{
+    printf("MISMATCH %s/%s %dx%d", backend, pair->name, mismatch->width, mismatch->height);
+    if (mismatch->threads > 0)
+    {
+        printf(" (%d threads)", mismatch->threads);
+    }
+    printf(": %s plane '%s' sample (%d, %d) byte %d, expected 0x%02x, got 0x%02x\n",
+           mismatch->what, mismatch->plane, mismatch->x, mismatch->y, mismatch->byte,
+           (uint32_t)mismatch->expected, (uint32_t)mismatch->actual);
+}
@@ -0,0 +1,55 @@
+#ifndef __DIFF__H__
+#define __DIFF__H__
+
+typedef pixctrl_result_t(*diff_convert_fn_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+typedef enum {
+    DIFF_RESULT_MATCH,
+    DIFF_RESULT_MISMATCH,
+    DIFF_RESULT_SKIPPED,            /* the reference or the candidate rejected the parameters */
+} diff_result_t;
+
+typedef struct {
+    uint64_t state;                 /* xorshift64*, never 0 */
+} diff_random_t;
+
+typedef struct {
+    int32_t width;
+    int32_t height;
+    int32_t threads;                /* highest thread count compared against 1 */
+    diff_random_t random;           /* offsets, rectangles, tiles and content not given below */
+    const uint8_t *content;         /* source bytes repeated over the frames, NULL for random content */
+    size_t content_len;
+} diff_param_t;
+
+typedef struct {
+    const char *what;               /* e.g. 'dst', 'stats', 'sad (2 threads)' */
+    const char *plane;              /* e.g. 'Y', 'UV', 'packed' */
+    int32_t x, y;                   /* sample of the plane, a packed 4:2:2 sample is one macro-pixel */
+    int32_t byte;                   /* byte within the sample */
+    uint8_t expected, actual;
+    int32_t width, height;          /* frame the comparison ran on */
+    int32_t threads;                /* thread count of the differing run, 0 for single threaded paths */
+} diff_mismatch_t;
+
+/* one reference conversion, 'reference' is the generic converter (NULL for the motion formats) */
+typedef struct {
+    const char *name;
+    pixctrl_fmt_t src_fmt;
+    pixctrl_fmt_t dst_fmt;
+    diff_convert_fn_t reference;
+} diff_pair_t;
+
+/* a path that must reproduce the generic output bit for bit, an optimized backend adds its own entry */
+typedef struct {
+    const char *name;
+    const diff_pair_t *(*get_pairs)(int32_t *pairs);
+    diff_result_t (*run)(const diff_pair_t *pair, diff_param_t *param, diff_mismatch_t *mismatch);
+} diff_backend_t;
+
+extern const diff_backend_t *get_diff_backends(int32_t *backends);
+extern void init_diff_random(diff_random_t *random, uint64_t seed);
+extern uint32_t get_diff_random(diff_random_t *random, uint32_t range);
+extern void print_diff_mismatch(const char *backend, const diff_pair_t *pair, const diff_mismatch_t *mismatch);
+
+#endif  //!__DIFF__H__
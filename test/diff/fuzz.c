@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "pixctrl.h"
+#include "diff.h"
+
+#define FUZZ_HEADER_LEN         (8)
+#define FUZZ_MAX_WIDTH          (256)
+#define FUZZ_MAX_HEIGHT         (128)
+#define FUZZ_MAX_THREADS        (8)
+
+extern int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/* libFuzzer entry of the same comparison, the input picks the case and the size and then becomes the content
+ *  byte 0      : backend
+ *  byte 1, 2   : pair of the backend (little endian)
+ *  byte 3      : width - 1
+ *  byte 4      : height - 1 (modulo FUZZ_MAX_HEIGHT)
+ *  byte 5      : highest thread count - 1 (modulo FUZZ_MAX_THREADS)
+ *  byte 6, 7   : seed of the offsets, rectangles and tiles
+ *  byte 8..    : source bytes, repeated over the frames (random when empty)
+ * A mismatch is printed and aborts, so libFuzzer keeps the input as a crash. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    const diff_backend_t *backends;
+    const diff_pair_t *pairs;
+    diff_param_t param;
+    diff_mismatch_t mismatch;
+    int32_t b, p, diff_backends, diff_pairs;
+
+    if (size >= FUZZ_HEADER_LEN)
+    {
+        backends = get_diff_backends(&diff_backends);
+        b = (int32_t)data[0] % diff_backends;
+        pairs = backends[b].get_pairs(&diff_pairs);
+        p = ((int32_t)data[1] | ((int32_t)data[2] << 8)) % diff_pairs;
+
+        param.width = 1 + ((int32_t)data[3] % FUZZ_MAX_WIDTH);
+        param.height = 1 + ((int32_t)data[4] % FUZZ_MAX_HEIGHT);
+        param.threads = 1 + ((int32_t)data[5] % FUZZ_MAX_THREADS);
+        init_diff_random(&param.random, (uint64_t)data[6] | ((uint64_t)data[7] << 8));
+        param.content = (size > FUZZ_HEADER_LEN) ? &data[FUZZ_HEADER_LEN] : NULL;
+        param.content_len = size - FUZZ_HEADER_LEN;
+
+        (void)memset(&mismatch, 0, sizeof(mismatch));
+        if (backends[b].run(&pairs[p], &param, &mismatch) == DIFF_RESULT_MISMATCH)
+        {
+            print_diff_mismatch(backends[b].name, &pairs[p], &mismatch);
+            abort();
+        }
+    }
+
+    return 0;
+}
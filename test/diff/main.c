@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "pixctrl.h"
+#include "diff.h"
+
+#define DEFAULT_SEED            (1)
+#define DEFAULT_ITERATIONS      (8)
+#define DEFAULT_MAX_SIZE        (72)
+#define DEFAULT_THREADS         (4)
+
+typedef struct {
+    const char *filter;
+    uint64_t seed;
+    int32_t iterations;
+    int32_t max_size;
+    int32_t threads;
+} diff_option_t;
+
+static void print_usage(const char *prog)
+{
+    printf("usage: %s [-f filter] [-s seed] [-n iterations] [-m max_size] [-t threads]\n", prog);
+    puts("  -f  run only cases whose name (e.g. 'roi/nv12_to_yuv420p') contains 'filter'");
+    printf("  -s  seed of the first iteration, iteration i runs seed + i (default %d)\n", DEFAULT_SEED);
+    printf("  -n  random sizes and contents per case (default %d)\n", DEFAULT_ITERATIONS);
+    printf("  -m  largest width and height (default %d)\n", DEFAULT_MAX_SIZE);
+    printf("  -t  highest thread count compared against one thread (default %d)\n", DEFAULT_THREADS);
+}
+
+static int32_t parse_option(int32_t argc, char *argv[], diff_option_t *option)
+{
+    int32_t ret = 0;
+    int opt;
+
+    option->filter = NULL;
+    option->seed = DEFAULT_SEED;
+    option->iterations = DEFAULT_ITERATIONS;
+    option->max_size = DEFAULT_MAX_SIZE;
+    option->threads = DEFAULT_THREADS;
+
+    while ((ret == 0) && ((opt = getopt(argc, argv, "f:s:n:m:t:h")) != -1))
+    {
+        switch (opt) {
+        case 'f':
+            option->filter = optarg;
+            break;
+        case 's':
+            option->seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'n':
+            option->iterations = atoi(optarg);
+            ret = (option->iterations > 0) ? 0 : -1;
+            break;
+        case 'm':
+            option->max_size = atoi(optarg);
+            ret = (option->max_size > 0) ? 0 : -1;
+            break;
+        case 't':
+            option->threads = atoi(optarg);
+            ret = (option->threads > 0) ? 0 : -1;
+            break;
+        default:
+            ret = -1;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+    char name[128];
+    diff_option_t option;
+    diff_param_t param;
+    diff_mismatch_t mismatch;
+    diff_result_t result;
+    const diff_backend_t *backends;
+    const diff_pair_t *pairs;
+    uint64_t seed;
+    int32_t b, p, i, diff_backends, diff_pairs, matched, skipped, mismatched;
+
+    if (parse_option(argc, argv, &option) == 0)
+    {
+        printf("seed %llu, %d iterations per case, sizes up to %dx%d, up to %d threads\n",
+               (unsigned long long)option.seed, option.iterations, option.max_size, option.max_size, option.threads);
+
+        backends = get_diff_backends(&diff_backends);
+        for (b = 0; b < diff_backends; ++b)
+        {
+            matched = 0;
+            skipped = 0;
+            mismatched = 0;
+            pairs = backends[b].get_pairs(&diff_pairs);
+            for (p = 0; p < diff_pairs; ++p)
+            {
+                (void)snprintf(name, sizeof(name), "%s/%s", backends[b].name, pairs[p].name);
+                if ((option.filter != NULL) && (strstr(name, option.filter) == NULL))
+                {
+                    continue;
+                }
+
+                /* every iteration draws its size from its own seed, so '-s seed -n 1' replays it alone */
+                for (i = 0; i < option.iterations; ++i)
+                {
+                    seed = option.seed + (uint64_t)i;
+                    init_diff_random(&param.random, seed);
+                    param.width = 1 + (int32_t)get_diff_random(&param.random, (uint32_t)option.max_size);
+                    param.height = 1 + (int32_t)get_diff_random(&param.random, (uint32_t)option.max_size);
+                    if (get_diff_random(&param.random, 2U) == 0U)
+                    {
+                        /* most converters take even sizes only, the odd ones cover the tails */
+                        param.width += param.width % 2;
+                        param.height += param.height % 2;
+                    }
+                    param.threads = option.threads;
+                    param.content = NULL;
+                    param.content_len = 0U;
+
+                    (void)memset(&mismatch, 0, sizeof(mismatch));
+                    result = backends[b].run(&pairs[p], &param, &mismatch);
+                    if (result == DIFF_RESULT_MISMATCH)
+                    {
+                        print_diff_mismatch(backends[b].name, &pairs[p], &mismatch);
+                        printf("  replay: %s -f %s -s %llu -n 1 -m %d -t %d\n",
+                               argv[0], name, (unsigned long long)seed, option.max_size, option.threads);
+                        ++mismatched;
+                        ret = 1;
+                        break;
+                    }
+                    else if (result == DIFF_RESULT_MATCH)
+                    {
+                        ++matched;
+                    }
+                    else
+                    {
+                        ++skipped;
+                    }
+                }
+            }
+
+            if ((matched + skipped + mismatched) > 0)
+            {
+                printf("%-14s %6d matched %6d skipped %6d mismatched\n", backends[b].name, matched, skipped, mismatched);
+            }
+        }
+    }
+    else
+    {
+        print_usage(argv[0]);
+        ret = -1;
+    }
+
+    return ret;
+}
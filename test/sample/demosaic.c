@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    pixctrl_bayer_t pattern;
+    const char *pattern_name;
+    pixctrl_raw_t raw;
+    const char *raw_name;
+    pixctrl_demosaic_method_t method;
+    const char *method_name;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+} demosaic_test_vector_t;
+
+static const demosaic_test_vector_t gsc_demosaic_test_vector[] = {
+    /* src   src      src  pattern             pattern raw                  raw         method                       method      dst      pixctrl              dst
+       group fmt      bpp                      name                         name                                     name        fmt      fmt                  bpp  width height */
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_RGGB, "rggb", PIXCTRL_RAW8,       "raw8",      PIXCTRL_DEMOSAIC_BILINEAR,   "bilinear", "rgb24", PIXCTRL_FMT_RGB24,   24,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_RGGB, "rggb", PIXCTRL_RAW8,       "raw8",      PIXCTRL_DEMOSAIC_EDGE_AWARE, "edge",     "rgb24", PIXCTRL_FMT_RGB24,   24,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_BGGR, "bggr", PIXCTRL_RAW10,      "raw10",     PIXCTRL_DEMOSAIC_EDGE_AWARE, "edge",     "bgra",  PIXCTRL_FMT_BGRA32,  32,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_GRBG, "grbg", PIXCTRL_RAW12,      "raw12",     PIXCTRL_DEMOSAIC_BILINEAR,   "bilinear", "nv12",  PIXCTRL_FMT_NV12,    12,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_GBRG, "gbrg", PIXCTRL_RAW10_MIPI, "raw10mipi", PIXCTRL_DEMOSAIC_EDGE_AWARE, "edge",     "nv12",  PIXCTRL_FMT_NV12,    12,  1280, 720, },
+};
+
+/* sample 'rgb24' through the colour filter array, scaled to the bit depth of 'raw' */
+static uint8_t *mosaic_rgb24(const uint8_t *rgb, pixctrl_bayer_t pattern, pixctrl_raw_t raw, int32_t width, int32_t height, size_t *len)
+{
+    static const int32_t red_row[] = { 0, 1, 0, 1, };
+    static const int32_t red_col[] = { 0, 1, 1, 0, };
+    int32_t row, col, channel;
+    uint32_t val;
+    uint8_t *bayer, *pos;
+
+    switch (raw)
+    {
+    case PIXCTRL_RAW8:
+        *len = (size_t)width * (size_t)height;
+        break;
+    case PIXCTRL_RAW10_MIPI:
+        *len = (((size_t)width * 5U) / 4U) * (size_t)height;
+        break;
+    default:
+        *len = (size_t)width * (size_t)height * 2U;
+        break;
+    }
+
+    bayer = (uint8_t *)malloc(*len);
+    assert(bayer != NULL);
+
+    for (row = 0; row < height; ++row)
+    {
+        for (col = 0; col < width; ++col)
+        {
+            if ((row % 2) == red_row[pattern])
+            {
+                channel = ((col % 2) == red_col[pattern]) ? 0 : 1;
+            }
+            else
+            {
+                channel = ((col % 2) != red_col[pattern]) ? 2 : 1;
+            }
+            val = (uint32_t)rgb[((((size_t)row * (size_t)width) + (size_t)col) * 3U) + (size_t)channel];
+
+            switch (raw)
+            {
+            case PIXCTRL_RAW8:
+                bayer[((size_t)row * (size_t)width) + (size_t)col] = (uint8_t)val;
+                break;
+            case PIXCTRL_RAW10_MIPI:
+                pos = &bayer[((size_t)row * (((size_t)width * 5U) / 4U)) + (((size_t)col / 4U) * 5U)];
+                val = (val << 2) | (val >> 6);
+                pos[col % 4] = (uint8_t)(val >> 2);
+                pos[4] = (uint8_t)((((col % 4) == 0) ? 0U : (uint32_t)pos[4]) | ((val & 0x3U) << (2 * (col % 4))));
+                break;
+            default:
+                val = (raw == PIXCTRL_RAW10) ? ((val << 2) | (val >> 6)) : ((val << 4) | (val >> 4));
+                pos = &bayer[(((size_t)row * (size_t)width) + (size_t)col) * 2U];
+                pos[0] = (uint8_t)(val & 0xFFU);
+                pos[1] = (uint8_t)(val >> 8);
+                break;
+            }
+        }
+    }
+
+    return bayer;
+}
+
+void test_demosaic(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_demosaic_test_vector) / sizeof(demosaic_test_vector_t));
+    const demosaic_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    size_t bayer_len;
+    uint8_t *bayer;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Demosaic");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_demosaic_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/demosaic/%02d_%s_%s-%dx%d_from_%s_%s.raw", 
+                                    dirpath, i + 1, vector->method_name, vector->dst_fmt_name,
+                                    vector->width, vector->height, vector->pattern_name, vector->raw_name);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        /* the sensor output is emulated by mosaicing the rgb resource, only the demosaic is timed */
+        bayer = mosaic_rgb24(src, vector->pattern, vector->raw, vector->width, vector->height, &bayer_len);
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        result = pixctrl_generic_demosaic(vector->pattern, vector->raw, vector->method,
+                                          bayer, vector->width, vector->height,
+                                          vector->dst_fmt, dst);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to demosaic");
+        }
+
+        free(src);
+        free(bayer);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    pixctrl_bayer_t pattern;
+    const char *pattern_name;
+    pixctrl_raw_t raw;
+    const char *raw_name;
+    int32_t bits;
+
+    double gamma;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+} isp_test_vector_t;
+
+/* daylight-ish gains and a mild saturation boost, every matrix row sums to unity */
+static const pixctrl_isp_t gsc_isp_params = {
+    { 1536, 1024, 1280, },
+    { 1331, -205, -102,
+      -154, 1280, -102,
+       -51, -256, 1331, },
+    NULL,
+};
+
+static const isp_test_vector_t gsc_isp_test_vector[] = {
+    /* src   src      src  pattern             pattern raw                  raw          bits gamma dst      pixctrl              dst
+       group fmt      bpp                      name                         name                    fmt      fmt                  bpp  width height */
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_RGGB, "rggb", PIXCTRL_RAW8,       "raw8",      8,   2.2,  "rgb24", PIXCTRL_FMT_RGB24,   24,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_RGGB, "rggb", PIXCTRL_RAW8,       "raw8",      8,   2.2,  "nv12",  PIXCTRL_FMT_NV12,    12,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_BGGR, "bggr", PIXCTRL_RAW10_MIPI, "raw10mipi", 10,  2.2,  "nv12",  PIXCTRL_FMT_NV12,    12,  1280, 720, },
+    { "rgb", "rgb24", 24,  PIXCTRL_BAYER_GRBG, "grbg", PIXCTRL_RAW12,      "raw12",     12,  1.8,  "bgra",  PIXCTRL_FMT_BGRA32,  32,  1280, 720, },
+};
+
+void test_isp(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_isp_test_vector) / sizeof(isp_test_vector_t));
+    const isp_test_vector_t *vector;
+    pixctrl_isp_t isp;
+    pixctrl_result_t result;
+    uint8_t *gamma_lut;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    size_t bayer_len;
+    uint8_t *bayer;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST ISP");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_isp_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/isp/%02d_isp_%s-%dx%d_from_%s_%s.raw", 
+                                    dirpath, i + 1, vector->dst_fmt_name,
+                                    vector->width, vector->height, vector->pattern_name, vector->raw_name);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        bayer = mosaic_rgb24(src, vector->pattern, vector->raw, vector->width, vector->height, &bayer_len);
+
+        gamma_lut = (uint8_t *)malloc((size_t)1 << vector->bits);
+        assert(gamma_lut != NULL);
+        result = pixctrl_generic_isp_gamma_lut(vector->gamma, vector->bits, gamma_lut);
+        isp = gsc_isp_params;
+        isp.gamma_lut = gamma_lut;
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        if (result == PIXCTRL_SUCCESS)
+        {
+            result = pixctrl_generic_isp(&isp, vector->pattern, vector->raw, PIXCTRL_DEMOSAIC_EDGE_AWARE,
+                                         bayer, vector->width, vector->height,
+                                         vector->dst_fmt, dst);
+        }
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to run the isp");
+        }
+
+        free(src);
+        free(bayer);
+        free(gamma_lut);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef pixctrl_result_t (*pixctrl_tiled_converter_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    const char *tiled_fmt;
+    pixctrl_fmt_t tiled_pixctrl_fmt;
+    pixctrl_tiled_converter_t tiler;
+
+    const char *dst_group;
+    const char *dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+    pixctrl_tiled_converter_t converter;
+} detile_test_vector_t;
+
+static const detile_test_vector_t gsc_detile_test_vector[] = {
+    /* src   src     src  tiled         pixctrl                  tiler                                dst       dst        dst
+       group fmt     bpp  fmt           fmt                                                           group     fmt        bpp  width height converter */
+    { "yuv", "nv12", 12,  "nv12_16x16", PIXCTRL_FMT_NV12_16X16,  pixctrl_generic_nv12_to_nv12_16x16,  "detile", "nv12",    12,  1280, 720,   pixctrl_generic_nv12_16x16_to_nv12,    },
+    { "yuv", "nv12", 12,  "nv12_16x16", PIXCTRL_FMT_NV12_16X16,  pixctrl_generic_nv12_to_nv12_16x16,  "detile", "yuv420p", 12,  1280, 720,   pixctrl_generic_nv12_16x16_to_yuv420p, },
+    { "yuv", "nv12", 12,  "nv12_16x16", PIXCTRL_FMT_NV12_16X16,  pixctrl_generic_nv12_to_nv12_16x16,  "detile", "bgra",    32,  1280, 720,   pixctrl_generic_nv12_16x16_to_bgra,    },
+    { "yuv", "nv12", 12,  "nv12_64x32", PIXCTRL_FMT_NV12_64X32,  pixctrl_generic_nv12_to_nv12_64x32,  "detile", "nv12",    12,  1280, 720,   pixctrl_generic_nv12_64x32_to_nv12,    },
+    { "yuv", "nv12", 12,  "nv12_64x32", PIXCTRL_FMT_NV12_64X32,  pixctrl_generic_nv12_to_nv12_64x32,  "detile", "yuv420p", 12,  1280, 720,   pixctrl_generic_nv12_64x32_to_yuv420p, },
+    { "yuv", "nv12", 12,  "nv12_64x32", PIXCTRL_FMT_NV12_64X32,  pixctrl_generic_nv12_to_nv12_64x32,  "detile", "rgb24",   24,  1280, 720,   pixctrl_generic_nv12_64x32_to_rgb24,   },
+    { "yuv", "nv12", 12,  "nv12_64x32", PIXCTRL_FMT_NV12_64X32,  pixctrl_generic_nv12_to_nv12_64x32,  "detile", "bgra",    32,  1280, 720,   pixctrl_generic_nv12_64x32_to_bgra,    },
+};
+
+void test_detile_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_detile_test_vector) / sizeof(detile_test_vector_t));
+    const detile_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    size_t tiled_len;
+    uint8_t *tiled;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Tiled YUV Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_detile_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/%s/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, vector->dst_group, i + 1, vector->dst_fmt,
+                                    vector->width, vector->height, vector->tiled_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        /* the decoder output is emulated by tiling the linear resource, only the detile is timed */
+        tiled_len = pixctrl_get_image_size(vector->tiled_pixctrl_fmt, vector->width, vector->height);
+        tiled = (uint8_t *)malloc(tiled_len);
+        assert(tiled != NULL);
+        result = vector->tiler(src, tiled, vector->width, vector->height);
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        if (result == PIXCTRL_SUCCESS)
+        {
+            result = vector->converter(tiled, dst, vector->width, vector->height);
+        }
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to detile");
+        }
+
+        free(src);
+        free(tiled);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    pixctrl_rect_t rects[3];
+    int32_t rect_count;
+} dirty_rect_test_vector_t;
+
+static const dirty_rect_test_vector_t gsc_dirty_rect_test_vector[] = {
+    /* src   src      pixctrl              src  dst        pixctrl               dst  src          dirty                                                          rect
+       group fmt      fmt                  bpp  fmt        fmt                   bpp  width height rects                                                          count */
+    { "rgb", "bgra",  PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   { { 101, 37, 300, 21 }, { 640, 360, 64, 64 }, { 1200, 700, 200, 200 } }, 3, },
+    { "rgb", "bgra",  PIXCTRL_FMT_BGRA32,  32,  "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   { { 0, 0, 1280, 33 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },              1, },
+    { "rgb", "rgb24", PIXCTRL_FMT_RGB24,   24,  "nv21",    PIXCTRL_FMT_NV21,     12,  1280, 720,   { { 13, 13, 7, 7 }, { 500, 100, 11, 400 }, { 0, 0, 0, 0 } },         2, },
+};
+
+void test_dirty_rect_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_dirty_rect_test_vector) / sizeof(dirty_rect_test_vector_t));
+    int32_t r, row, col;
+    const dirty_rect_test_vector_t *vector;
+    const pixctrl_rect_t *rect;
+    pixctrl_rect_t frame;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len, offset;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Dirty Rectangle Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_dirty_rect_test_vector[i];
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/dirty_rect/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->dst_fmt_name,
+                                    vector->width, vector->height, vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        /* the previous output is the whole frame, then the dirty rectangles of the source are inverted */
+        frame.x = 0;
+        frame.y = 0;
+        frame.width = vector->width;
+        frame.height = vector->height;
+        result = pixctrl_generic_convert_dirty_rects(vector->fmt, src, vector->width, vector->height,
+                                                     vector->dst_fmt, dst, &frame, 1);
+        assert(result == PIXCTRL_SUCCESS);
+        for (r = 0; r < vector->rect_count; ++r)
+        {
+            rect = &vector->rects[r];
+            for (row = rect->y; row < (rect->y + rect->height) && (row < vector->height); ++row)
+            {
+                for (col = rect->x; col < (rect->x + rect->width) && (col < vector->width); ++col)
+                {
+                    offset = (((size_t)row * (size_t)vector->width) + (size_t)col) * (vector->src_bpp / 8);
+                    (void)memset(&src[offset], 0xff - src[offset], vector->src_bpp / 8);
+                }
+            }
+        }
+
+        get_timestamp(&start);
+        result = pixctrl_generic_convert_dirty_rects(vector->fmt, src, vector->width, vector->height,
+                                                     vector->dst_fmt, dst, vector->rects, vector->rect_count);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to convert");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    int32_t tile_size;
+    pixctrl_rect_t damage;      /* inverted in the source between the two frames */
+} change_detect_test_vector_t;
+
+static const change_detect_test_vector_t gsc_change_detect_test_vector[] = {
+    /* src   src      pixctrl              src  dst        pixctrl               dst  src          tile  damage
+       group fmt      fmt                  bpp  fmt        fmt                   bpp  width height size                      */
+    { "rgb", "bgra",  PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   64,   { 300, 200, 90, 40 }, },
+    { "rgb", "rgb24", PIXCTRL_FMT_RGB24,   24,  "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   32,   { 1250, 700, 30, 20 }, },
+};
+
+void test_change_detect_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_change_detect_test_vector) / sizeof(change_detect_test_vector_t));
+    int32_t row, col, changed_count = 0;
+    const change_detect_test_vector_t *vector;
+    pixctrl_change_detect_t *detect;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len, offset;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Change Detect Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_change_detect_test_vector[i];
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/dirty_rect/%02d_changed_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->dst_fmt_name,
+                                    vector->width, vector->height, vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        result = pixctrl_generic_change_detect_create(vector->fmt, vector->width, vector->height,
+                                                      vector->dst_fmt, vector->tile_size, &detect);
+        assert(result == PIXCTRL_SUCCESS);
+
+        /* the first frame is converted whole, the second one only where the damage landed */
+        result = pixctrl_generic_change_detect_convert(detect, src, dst, NULL, NULL);
+        assert(result == PIXCTRL_SUCCESS);
+        for (row = vector->damage.y; row < (vector->damage.y + vector->damage.height) && (row < vector->height); ++row)
+        {
+            for (col = vector->damage.x; col < (vector->damage.x + vector->damage.width) && (col < vector->width); ++col)
+            {
+                offset = (((size_t)row * (size_t)vector->width) + (size_t)col) * (vector->src_bpp / 8);
+                (void)memset(&src[offset], 0xff - src[offset], vector->src_bpp / 8);
+            }
+        }
+
+        get_timestamp(&start);
+        result = pixctrl_generic_change_detect_convert(detect, src, dst, NULL, &changed_count);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to convert");
+        }
+
+        pixctrl_generic_change_detect_destroy(detect);
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec] (%d tiles changed)\n", elapsed.sec, elapsed.nsec, changed_count);
+    }
+}
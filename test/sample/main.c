@@ -15,7 +15,25 @@ int32_t main(int32_t argc, char *argv[])
     {
         test_rgb2rgb_convert(dirpath);
         test_rgb2yuv_convert(dirpath);
+        test_rgb2yuv_odd_convert(dirpath);
+        test_dirty_rect_convert(dirpath);
+        test_change_detect_convert(dirpath);
+        test_roi_convert(dirpath);
+        test_rgb2gray_convert(dirpath);
         test_yuv2yuv_convert(dirpath);
+        test_yuv2gray_convert(dirpath);
+        test_yuv2rgb_convert(dirpath);
+        test_detile_convert(dirpath);
+        test_rgb_alpha_mix(dirpath);
+        test_rgb_onto_yuv_mix(dirpath);
+        test_resize(dirpath);
+        test_resize_convert(dirpath);
+        test_rotate(dirpath);
+        test_rotate_convert(dirpath);
+        test_demosaic(dirpath);
+        test_isp(dirpath);
+        test_luma_stats(dirpath);
+        test_motion(dirpath);
     }
     else
     {
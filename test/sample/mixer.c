@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef pixctrl_result_t(*mixer_vector_entry_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    const char *dst_group;
+    const char *dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    mixer_vector_entry_t entry;
+} mixer_test_vector_t;
+
+static const mixer_test_vector_t gsc_mixer_test_vector[] = {
+    /* src   src     src  dst      dst                   dst
+       group fmt     bpp  group    fmt                   bpp width height converter */
+    { "rgb", "rgba", 32,  "mixer", "rgba_premultiplied", 32, 1280, 720,   pixctrl_generic_rgba_premultiply,   },
+    { "rgb", "bgra", 32,  "mixer", "bgra_premultiplied", 32, 1280, 720,   pixctrl_generic_bgra_premultiply,   },
+    { "rgb", "argb", 32,  "mixer", "argb_premultiplied", 32, 1280, 720,   pixctrl_generic_argb_premultiply,   },
+    { "rgb", "abgr", 32,  "mixer", "abgr_premultiplied", 32, 1280, 720,   pixctrl_generic_abgr_premultiply,   },
+
+    { "rgb", "rgba", 32,  "mixer", "rgba_straight",      32, 1280, 720,   pixctrl_generic_rgba_unpremultiply, },
+    { "rgb", "bgra", 32,  "mixer", "bgra_straight",      32, 1280, 720,   pixctrl_generic_bgra_unpremultiply, },
+    { "rgb", "argb", 32,  "mixer", "argb_straight",      32, 1280, 720,   pixctrl_generic_argb_unpremultiply, },
+    { "rgb", "abgr", 32,  "mixer", "abgr_straight",      32, 1280, 720,   pixctrl_generic_abgr_unpremultiply, },
+};
+
+void test_rgb_alpha_mix(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_mixer_test_vector) / sizeof(mixer_test_vector_t));
+    int32_t width, height;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len, expected_src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST RGB Alpha Mix");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        width = gsc_mixer_test_vector[i].width;
+        height = gsc_mixer_test_vector[i].height;
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, gsc_mixer_test_vector[i].src_group,
+                                     gsc_mixer_test_vector[i].src_fmt,
+                                     width,
+                                     height);
+        (void)sprintf(result_path, "%s/result/%s/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, gsc_mixer_test_vector[i].dst_group,
+                                    i + 1,
+                                    gsc_mixer_test_vector[i].dst_fmt,
+                                    width,
+                                    height,
+                                    gsc_mixer_test_vector[i].src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+
+        expected_src_len = (((size_t)gsc_mixer_test_vector[i].width * gsc_mixer_test_vector[i].src_bpp) / 8) * (size_t)gsc_mixer_test_vector[i].height;
+        assert(src_len == expected_src_len);
+        (void)expected_src_len;
+
+        dst_len = (((size_t)gsc_mixer_test_vector[i].width * gsc_mixer_test_vector[i].dst_bpp) / 8) * (size_t)gsc_mixer_test_vector[i].height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        gsc_mixer_test_vector[i].entry(src, dst, width, height);
+        get_timestamp(&end);
+
+        save_data_as_file(result_path, dst, dst_len);
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef pixctrl_result_t(*blend_vector_entry_t)(uint8_t *src, int32_t src_width, int32_t src_height,
+                                                pixctrl_alpha_mode_t alpha_mode, uint8_t *dst, int32_t width, int32_t height,
+                                                int32_t x, int32_t y);
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    const char *dst_group;
+    const char *dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+    int32_t x;
+    int32_t y;
+    pixctrl_alpha_mode_t alpha_mode;
+
+    blend_vector_entry_t entry;
+} blend_test_vector_t;
+
+static const blend_test_vector_t gsc_blend_test_vector[] = {
+    /* src   src     src  dst    dst        dst
+       group fmt     bpp  group  fmt        bpp width height x     y     alpha mode                   blender */
+    { "rgb", "rgba", 32,  "yuv", "nv12",    12, 1280, 720,   640,  360,  PIXCTRL_ALPHA_STRAIGHT,      pixctrl_generic_rgba_blend_onto_nv12, },
+    { "rgb", "bgra", 32,  "yuv", "nv21",    12, 1280, 720,   -641, -361, PIXCTRL_ALPHA_STRAIGHT,      pixctrl_generic_bgra_blend_onto_nv21, },
+    { "rgb", "argb", 32,  "yuv", "yuv420p", 12, 1280, 720,   321,  181,  PIXCTRL_ALPHA_PREMULTIPLIED, pixctrl_generic_argb_blend_onto_yuv420p, },
+    { "rgb", "abgr", 32,  "yuv", "nv12",    12, 1280, 720,   0,    0,    PIXCTRL_ALPHA_PREMULTIPLIED, pixctrl_generic_abgr_blend_onto_nv12, },
+};
+
+void test_rgb_onto_yuv_mix(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_blend_test_vector) / sizeof(blend_test_vector_t));
+    int32_t width, height;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len, dst_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST RGB onto YUV Mix");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        width = gsc_blend_test_vector[i].width;
+        height = gsc_blend_test_vector[i].height;
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, gsc_blend_test_vector[i].dst_group,
+                                     gsc_blend_test_vector[i].dst_fmt,
+                                     width,
+                                     height);
+        (void)sprintf(result_path, "%s/result/mixer/%02d_blend_%s-%dx%d_onto_%s.raw", 
+                                    dirpath, i + 1,
+                                    gsc_blend_test_vector[i].src_fmt,
+                                    width,
+                                    height,
+                                    gsc_blend_test_vector[i].dst_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        /* the frame is blended in place, so it is loaded as the destination */
+        dst = load_rawdata(resource_path, &dst_len);
+        assert(dst != NULL);
+        assert(dst_len == ((((size_t)width * gsc_blend_test_vector[i].dst_bpp) / 8) * (size_t)height));
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, gsc_blend_test_vector[i].src_group,
+                                     gsc_blend_test_vector[i].src_fmt,
+                                     width,
+                                     height);
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)width * gsc_blend_test_vector[i].src_bpp) / 8) * (size_t)height));
+
+        get_timestamp(&start);
+        gsc_blend_test_vector[i].entry(src, width, height, gsc_blend_test_vector[i].alpha_mode,
+                                       dst, width, height,
+                                       gsc_blend_test_vector[i].x, gsc_blend_test_vector[i].y);
+        get_timestamp(&end);
+
+        save_data_as_file(result_path, dst, dst_len);
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
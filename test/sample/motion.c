@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t bpp;
+
+    int32_t width;
+    int32_t height;
+
+    int32_t shift;          /* rows the current frame moved down from the previous one */
+    uint32_t threshold;
+    int32_t threads;
+} motion_test_vector_t;
+
+static const motion_test_vector_t gsc_motion_test_vector[] = {
+    /* src   src        pixctrl               bpp  src          shift threshold threads
+       group fmt        fmt                        width height                        */
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   4,    2048,     1, },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   4,    2048,     4, },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   1,    1024,     2, },
+};
+
+void test_motion(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_motion_test_vector) / sizeof(motion_test_vector_t));
+    int32_t height, blocks;
+    const motion_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src, *curr;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char map_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst, *map;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Motion");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_motion_test_vector[i];
+        height = vector->height - vector->shift;
+        blocks = ((vector->width + PIXCTRL_MOTION_BLOCK - 1) / PIXCTRL_MOTION_BLOCK) *
+                 ((height + PIXCTRL_MOTION_BLOCK - 1) / PIXCTRL_MOTION_BLOCK);
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/motion/%02d_absdiff_gray-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->width, height, vector->src_fmt);
+        (void)sprintf(map_path, "%s/result/motion/%02d_map_gray-%dx%d_from_%s.raw", 
+                                 dirpath, i + 1,
+                                 (vector->width + PIXCTRL_MOTION_BLOCK - 1) / PIXCTRL_MOTION_BLOCK,
+                                 (height + PIXCTRL_MOTION_BLOCK - 1) / PIXCTRL_MOTION_BLOCK, vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->bpp) / 8) * (size_t)vector->height));
+
+        /* the previous frame is the top of the image, the current one the same rows 'shift' lower */
+        curr = src + ((size_t)vector->width * (size_t)vector->shift);
+
+        dst_len = (size_t)vector->width * (size_t)height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+        map = (uint8_t *)malloc((size_t)blocks);
+        assert(map != NULL);
+
+        get_timestamp(&start);
+        result = pixctrl_generic_absdiff(PIXCTRL_FMT_GRAY8, src, curr, vector->width, height, dst, vector->threads);
+        if (result == PIXCTRL_SUCCESS)
+        {
+            result = pixctrl_generic_motion_map(vector->fmt, src, curr, vector->width, height,
+                                                vector->threshold, map, vector->threads);
+        }
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+            save_data_as_file(map_path, map, (size_t)blocks);
+        }
+        else
+        {
+            puts("failed to compare");
+        }
+
+        free(src);
+        free(dst);
+        free(map);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
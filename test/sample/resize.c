@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t bpp;
+
+    int32_t src_width;
+    int32_t src_height;
+    int32_t dst_width;
+    int32_t dst_height;
+
+    pixctrl_resize_method_t method;
+    const char *method_name;
+} resize_test_vector_t;
+
+static const resize_test_vector_t gsc_resize_test_vector[] = {
+    /* src   src        pixctrl                bpp  src          dst          method                           method
+       group fmt        fmt                         width height width height                                  name */
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,    32,  1280, 720,   640,  360,   PIXCTRL_RESIZE_NEAREST_NEIGHBOR, "nearest",  },
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,    32,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,    32,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,     24,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_NEAREST_NEIGHBOR, "nearest",  },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,     24,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,     24,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   640,  360,   PIXCTRL_RESIZE_NEAREST_NEIGHBOR, "nearest",  },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,   12,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_NEAREST_NEIGHBOR, "nearest",  },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,   12,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,   12,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+    { "yuv", "yuv422p", PIXCTRL_FMT_YUV422P,   16,  1280, 720,   960,  540,   PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "yuv", "yuv444p", PIXCTRL_FMT_YUV444P,   24,  1280, 720,   960,  540,   PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+};
+
+void test_resize(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_resize_test_vector) / sizeof(resize_test_vector_t));
+    const resize_test_vector_t *vector;
+    pixctrl_resize_t *resize;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Resize");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_resize_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->src_width, vector->src_height);
+        (void)sprintf(result_path, "%s/result/resize/%02d_%s_%s-%dx%d_from_%dx%d.raw", 
+                                    dirpath, i + 1, vector->method_name, vector->src_fmt,
+                                    vector->dst_width, vector->dst_height,
+                                    vector->src_width, vector->src_height);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->src_width * vector->bpp) / 8) * (size_t)vector->src_height));
+
+        dst_len = (((size_t)vector->dst_width * vector->bpp) / 8) * (size_t)vector->dst_height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        /* the tables are built once per geometry, only the resize itself is timed */
+        if (pixctrl_generic_resize_create(vector->fmt, vector->method,
+                                          vector->src_width, vector->src_height,
+                                          vector->dst_width, vector->dst_height, &resize) == PIXCTRL_SUCCESS)
+        {
+            get_timestamp(&start);
+            (void)pixctrl_generic_resize(resize, src, dst);
+            get_timestamp(&end);
+
+            pixctrl_generic_resize_destroy(resize);
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            start.sec = 0U;
+            start.nsec = 0U;
+            end = start;
+            puts("failed to create the resize context");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t src_width;
+    int32_t src_height;
+    int32_t dst_width;
+    int32_t dst_height;
+
+    pixctrl_resize_method_t method;
+    const char *method_name;
+} resize_convert_test_vector_t;
+
+static const resize_convert_test_vector_t gsc_resize_convert_test_vector[] = {
+    /* src   src        pixctrl              src  dst        pixctrl               dst  src          dst          method                           method
+       group fmt        fmt                  bpp  fmt        fmt                   bpp  width height width height                                  name */
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,  32,  "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BICUBIC,          "bicubic",  },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,    12,  "rgb24",   PIXCTRL_FMT_RGB24,    24,  1280, 720,   640,  360,   PIXCTRL_RESIZE_BILINEAR,         "bilinear", },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,    12,  "bgra",    PIXCTRL_FMT_BGRA32,   32,  1280, 720,   1920, 1080,  PIXCTRL_RESIZE_NEAREST_NEIGHBOR, "nearest",  },
+};
+
+void test_resize_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_resize_convert_test_vector) / sizeof(resize_convert_test_vector_t));
+    const resize_convert_test_vector_t *vector;
+    pixctrl_resize_t *resize;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Resize and Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_resize_convert_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->src_width, vector->src_height);
+        (void)sprintf(result_path, "%s/result/resize/%02d_%s_cvt_%s-%dx%d_from_%s-%dx%d.raw", 
+                                    dirpath, i + 1, vector->method_name, vector->dst_fmt_name,
+                                    vector->dst_width, vector->dst_height,
+                                    vector->src_fmt, vector->src_width, vector->src_height);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->src_width * vector->src_bpp) / 8) * (size_t)vector->src_height));
+
+        dst_len = (((size_t)vector->dst_width * vector->dst_bpp) / 8) * (size_t)vector->dst_height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        if (pixctrl_generic_resize_create(vector->fmt, vector->method,
+                                          vector->src_width, vector->src_height,
+                                          vector->dst_width, vector->dst_height, &resize) == PIXCTRL_SUCCESS)
+        {
+            get_timestamp(&start);
+            (void)pixctrl_generic_resize_convert(resize, src, vector->dst_fmt, dst);
+            get_timestamp(&end);
+
+            pixctrl_generic_resize_destroy(resize);
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            start.sec = 0U;
+            start.nsec = 0U;
+            end = start;
+            puts("failed to create the resize context");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
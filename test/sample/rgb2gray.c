@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef convert_test_vector_t rgb2gray_test_vector_t;
+
+static const rgb2gray_test_vector_t gsc_rgb2gray_test_vector[] = {
+    /* src   src        src  dst         dst     dst
+       group fmt        bpp  group       fmt     bpp width height converter */
+    { "rgb", "rgb24",  24,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_rgb24_to_gray8, },
+    { "rgb", "bgr24",  24,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_bgr24_to_gray8, },
+    { "rgb", "argb",   32,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_argb_to_gray8, },
+    { "rgb", "abgr",   32,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_abgr_to_gray8, },
+    { "rgb", "rgba",   32,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_rgba_to_gray8, },
+    { "rgb", "bgra",   32,  "rgb2gray", "gray8", 8,  1280, 720,   pixctrl_generic_bgra_to_gray8, },
+};
+
+void test_rgb2gray_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_rgb2gray_test_vector) / sizeof(rgb2gray_test_vector_t));
+    int32_t width, height;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len, expected_src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST RGB to GRAY Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        width = gsc_rgb2gray_test_vector[i].width;
+        height = gsc_rgb2gray_test_vector[i].height;
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, gsc_rgb2gray_test_vector[i].src_group,
+                                     gsc_rgb2gray_test_vector[i].src_fmt,
+                                     width,
+                                     height);
+        (void)sprintf(result_path, "%s/result/%s/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, gsc_rgb2gray_test_vector[i].dst_group,
+                                    i + 1,
+                                    gsc_rgb2gray_test_vector[i].dst_fmt,
+                                    width,
+                                    height,
+                                    gsc_rgb2gray_test_vector[i].src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+
+        expected_src_len = (((size_t)gsc_rgb2gray_test_vector[i].width * gsc_rgb2gray_test_vector[i].src_bpp) / 8) * (size_t)gsc_rgb2gray_test_vector[i].height;
+        assert(src_len == expected_src_len);
+        (void)expected_src_len;
+
+        dst_len = (((size_t)gsc_rgb2gray_test_vector[i].width * gsc_rgb2gray_test_vector[i].dst_bpp) / 8) * (size_t)gsc_rgb2gray_test_vector[i].height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        gsc_rgb2gray_test_vector[i].entry(src, dst, width, height);
+        get_timestamp(&end);
+
+        save_data_as_file(result_path, dst, dst_len);
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
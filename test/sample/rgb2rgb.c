@@ -7,22 +7,7 @@
 #include "pixctrl.h"
 #include "test_vector.h"
 
-typedef pixctrl_result_t(*rgb2rgb_vector_entry_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
-
-typedef struct {
-    const char *src_group;
-    const char *src_fmt;
-    size_t src_bpp;
-
-    const char *dst_group;
-    const char *dst_fmt;
-    size_t dst_bpp;
-
-    int32_t width;
-    int32_t height;
-
-    rgb2rgb_vector_entry_t entry;
-} rgb2rgb_test_vector_t;
+typedef convert_test_vector_t rgb2rgb_test_vector_t;
 
 static const rgb2rgb_test_vector_t gsc_rgb2rgb_test_vector[] = {
     /* src   src      src  dst        dst         dst
@@ -51,6 +36,13 @@ static const rgb2rgb_test_vector_t gsc_rgb2rgb_test_vector[] = {
     { "rgb", "bgr24", 24,  "rgb2rgb", "rgb24",   24, 1280, 720,   pixctrl_generic_bgr24_to_rgb24, },
 };
 
+const convert_test_vector_t *get_rgb2rgb_test_vector(int32_t *test_vectors)
+{
+    *test_vectors = (int32_t)(sizeof(gsc_rgb2rgb_test_vector) / sizeof(rgb2rgb_test_vector_t));
+
+    return gsc_rgb2rgb_test_vector;
+}
+
 void test_rgb2rgb_convert(char *dirpath)
 {
     int32_t i, test_vectors = (int32_t)(sizeof(gsc_rgb2rgb_test_vector) / sizeof(rgb2rgb_test_vector_t));
@@ -67,7 +59,7 @@ void test_rgb2rgb_convert(char *dirpath)
     char *dst_filename;
     size_t dst_len;
 
-    test_timestamp_t start, end;
+    test_timestamp_t start, end, elapsed;
 
     puts("###########################################################");
     puts("                TEST RGB to RGB Convert");
@@ -119,6 +111,7 @@ void test_rgb2rgb_convert(char *dirpath)
         free(src);
         free(dst);
 
-        printf("%zu.%09zu [sec]\n", end.sec - start.sec, end.nsec - start.nsec);
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
     }
 }
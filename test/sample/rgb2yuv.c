@@ -7,22 +7,7 @@
 #include "pixctrl.h"
 #include "test_vector.h"
 
-typedef pixctrl_result_t(*rgb2yuv_vector_entry_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
-
-typedef struct {
-    const char *src_group;
-    const char *src_fmt;
-    size_t src_bpp;
-
-    const char *dst_group;
-    const char *dst_fmt;
-    size_t dst_bpp;
-
-    int32_t width;
-    int32_t height;
-
-    rgb2yuv_vector_entry_t entry;
-} rgb2yuv_test_vector_t;
+typedef convert_test_vector_t rgb2yuv_test_vector_t;
 
 static const rgb2yuv_test_vector_t gsc_rgb2yuv_test_vector[] = {
     /* src   src      src  dst        dst         dst
@@ -94,6 +79,13 @@ static const rgb2yuv_test_vector_t gsc_rgb2yuv_test_vector[] = {
     { "rgb", "bgr24", 24,  "rgb2yuv", "yuv420p",  12, 1280, 720,   pixctrl_generic_bgr24_to_yuv420p, },
 };
 
+const convert_test_vector_t *get_rgb2yuv_test_vector(int32_t *test_vectors)
+{
+    *test_vectors = (int32_t)(sizeof(gsc_rgb2yuv_test_vector) / sizeof(rgb2yuv_test_vector_t));
+
+    return gsc_rgb2yuv_test_vector;
+}
+
 void test_rgb2yuv_convert(char *dirpath)
 {
     int32_t i, test_vectors = (int32_t)(sizeof(gsc_rgb2yuv_test_vector) / sizeof(rgb2yuv_test_vector_t));
@@ -110,7 +102,7 @@ void test_rgb2yuv_convert(char *dirpath)
     char *dst_filename;
     size_t dst_len;
 
-    test_timestamp_t start, end;
+    test_timestamp_t start, end, elapsed;
 
     puts("###########################################################");
     puts("                TEST RGB to YUV Convert");
@@ -162,6 +154,117 @@ void test_rgb2yuv_convert(char *dirpath)
         free(src);
         free(dst);
 
-        printf("%zu.%09zu [sec]\n", end.sec - start.sec, end.nsec - start.nsec);
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef struct {
+    const char *src_fmt;
+    size_t src_bpp;
+    int32_t src_width;
+    int32_t src_height;
+
+    const char *dst_fmt;
+    pixctrl_fmt_t dst_pixctrl_fmt;
+    int32_t width;
+    int32_t height;
+
+    convert_vector_entry_t entry;
+} rgb2yuv_odd_test_vector_t;
+
+static const rgb2yuv_odd_test_vector_t gsc_rgb2yuv_odd_test_vector[] = {
+    /* src      src  src              dst        pixctrl               crop
+       fmt      bpp  width   height   fmt        fmt                   width   height  converter */
+    { "rgb24",  24,  1280,   720,     "yuyv422", PIXCTRL_FMT_YUYV422,  1279,   719,    pixctrl_generic_rgb24_to_yuyv422, },
+    { "rgb24",  24,  1280,   720,     "uyvy422", PIXCTRL_FMT_UYVY422,  1279,   719,    pixctrl_generic_rgb24_to_uyvy422, },
+    { "rgb24",  24,  1280,   720,     "nv12",    PIXCTRL_FMT_NV12,     1279,   719,    pixctrl_generic_rgb24_to_nv12,    },
+    { "rgb24",  24,  1280,   720,     "nv21",    PIXCTRL_FMT_NV21,     1279,   719,    pixctrl_generic_rgb24_to_nv21,    },
+    { "rgb24",  24,  1280,   720,     "yuv422p", PIXCTRL_FMT_YUV422P,  1279,   719,    pixctrl_generic_rgb24_to_yuv422p, },
+    { "rgb24",  24,  1280,   720,     "yuv420p", PIXCTRL_FMT_YUV420P,  1279,   719,    pixctrl_generic_rgb24_to_yuv420p, },
+    { "rgb24",  24,  1280,   720,     "nv12",    PIXCTRL_FMT_NV12,     127,    71,     pixctrl_generic_rgb24_to_nv12,    },
+    { "rgb24",  24,  1280,   720,     "yuv420p", PIXCTRL_FMT_YUV420P,  127,    71,     pixctrl_generic_rgb24_to_yuv420p, },
+};
+
+void test_rgb2yuv_odd_convert(char *dirpath)
+{
+    int32_t i, row, test_vectors = (int32_t)(sizeof(gsc_rgb2yuv_odd_test_vector) / sizeof(rgb2yuv_odd_test_vector_t));
+    const rgb2yuv_odd_test_vector_t *vector;
+    pixctrl_result_t result;
+    size_t src_stride, crop_stride;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src, *crop;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST RGB to YUV Convert (Odd Size)");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_rgb2yuv_odd_test_vector[i];
+        (void)sprintf(resource_path, "%s/resource/rgb/%s-%dx%d.raw", 
+                                     dirpath, vector->src_fmt, vector->src_width, vector->src_height);
+        (void)sprintf(result_path, "%s/result/rgb2yuv_odd/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->dst_fmt, vector->width, vector->height,
+                                    vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->src_width * vector->src_bpp) / 8) * (size_t)vector->src_height));
+
+        /* crop the top-left corner into a tightly packed odd-sized frame */
+        src_stride = ((size_t)vector->src_width * vector->src_bpp) / 8;
+        crop_stride = ((size_t)vector->width * vector->src_bpp) / 8;
+        crop = (uint8_t *)malloc(crop_stride * (size_t)vector->height);
+        assert(crop != NULL);
+        for (row = 0; row < vector->height; ++row)
+        {
+            (void)memcpy(&crop[crop_stride * (size_t)row], &src[src_stride * (size_t)row], crop_stride);
+        }
+
+        dst_len = pixctrl_get_image_size(vector->dst_pixctrl_fmt, vector->width, vector->height);
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        result = vector->entry(crop, dst, vector->width, vector->height);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to convert");
+        }
+
+        free(src);
+        free(crop);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
     }
 }
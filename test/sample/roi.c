@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+    int32_t src_width;
+    int32_t src_height;
+    pixctrl_rect_t src_rect;
+
+    const char *dst_group;          /* the destination starts as this resource, NULL for a zeroed frame */
+    const char *dst_fmt;
+    pixctrl_fmt_t dst_pixctrl_fmt;
+    size_t dst_bpp;
+    int32_t dst_width;
+    int32_t dst_height;
+    int32_t dst_x;
+    int32_t dst_y;
+} roi_test_vector_t;
+
+static const roi_test_vector_t gsc_roi_test_vector[] = {
+    /* src    src         pixctrl               src   src              src                      dst     dst         pixctrl               dst   dst              dst
+       group  fmt         fmt                   bpp   width   height   rect                     group   fmt         fmt                   bpp   width   height   x     y */
+    { "rgb",  "bgra",     PIXCTRL_FMT_BGRA32,   32,   1280,   720,     { 640, 360, 320, 180 },  "yuv",  "nv12",     PIXCTRL_FMT_NV12,     12,   1280,   720,     32,   32, },
+    { "yuv",  "nv12",     PIXCTRL_FMT_NV12,     12,   1280,   720,     { 400, 200, 256, 256 },  NULL,   "rgb24",    PIXCTRL_FMT_RGB24,    24,   256,    256,     0,    0, },
+    { "yuv",  "yuyv422",  PIXCTRL_FMT_YUYV422,  16,   1280,   720,     { 0, 0, 640, 360 },      "yuv",  "yuv420p",  PIXCTRL_FMT_YUV420P,  12,   1280,   720,     640,  360, },
+    { "yuv",  "yuv420p",  PIXCTRL_FMT_YUV420P,  12,   1280,   720,     { 100, 100, 320, 240 },  NULL,   "yuv420p",  PIXCTRL_FMT_YUV420P,  12,   320,    240,     0,    0, },
+};
+
+void test_roi_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_roi_test_vector) / sizeof(roi_test_vector_t));
+    const roi_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Region of Interest Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_roi_test_vector[i];
+        dst_len = (((size_t)vector->dst_width * vector->dst_bpp) / 8) * (size_t)vector->dst_height;
+
+        (void)sprintf(result_path, "%s/result/roi/%02d_cvt_%s-%dx%d_from_%s-%dx%d+%d+%d.raw", 
+                                    dirpath, i + 1, vector->dst_fmt, vector->dst_width, vector->dst_height,
+                                    vector->src_fmt, vector->src_rect.width, vector->src_rect.height,
+                                    vector->src_rect.x, vector->src_rect.y);
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        if (vector->dst_group != NULL)
+        {
+            (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                         dirpath, vector->dst_group, vector->dst_fmt,
+                                         vector->dst_width, vector->dst_height);
+            dst = load_rawdata(resource_path, &src_len);
+            assert(dst != NULL);
+            assert(src_len == dst_len);
+        }
+        else
+        {
+            dst = (uint8_t *)calloc(dst_len, 1U);
+            assert(dst != NULL);
+        }
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->src_width, vector->src_height);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->src_width * vector->src_bpp) / 8) * (size_t)vector->src_height));
+
+        get_timestamp(&start);
+        result = pixctrl_generic_convert_roi(vector->fmt, src, vector->src_width, vector->src_height, &vector->src_rect,
+                                             vector->dst_pixctrl_fmt, dst, vector->dst_width, vector->dst_height,
+                                             vector->dst_x, vector->dst_y);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to convert");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
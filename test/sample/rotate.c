@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t bpp;
+
+    int32_t width;
+    int32_t height;
+
+    int32_t is_flip;
+    pixctrl_rotate_t rotate;
+    pixctrl_flip_t flip;
+    const char *op_name;
+} rotate_test_vector_t;
+
+static const rotate_test_vector_t gsc_rotate_test_vector[] = {
+    /* src   src        pixctrl                bpp  src          is    rotate               flip                     op
+       group fmt        fmt                         width height flip                                              name */
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,    32,  1280, 720,   0,    PIXCTRL_ROTATE_90,   PIXCTRL_FLIP_HORIZONTAL, "rotate90",  },
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,    32,  1280, 720,   0,    PIXCTRL_ROTATE_180,  PIXCTRL_FLIP_HORIZONTAL, "rotate180", },
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,    32,  1280, 720,   0,    PIXCTRL_ROTATE_270,  PIXCTRL_FLIP_HORIZONTAL, "rotate270", },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,     24,  1280, 720,   0,    PIXCTRL_ROTATE_90,   PIXCTRL_FLIP_HORIZONTAL, "rotate90",  },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,     24,  1280, 720,   1,    PIXCTRL_ROTATE_0,    PIXCTRL_FLIP_HORIZONTAL, "mirror",    },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   0,    PIXCTRL_ROTATE_90,   PIXCTRL_FLIP_HORIZONTAL, "rotate90",  },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   0,    PIXCTRL_ROTATE_270,  PIXCTRL_FLIP_HORIZONTAL, "rotate270", },
+    { "yuv", "nv12",    PIXCTRL_FMT_NV12,      12,  1280, 720,   1,    PIXCTRL_ROTATE_0,    PIXCTRL_FLIP_VERTICAL,   "flip",      },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,   12,  1280, 720,   0,    PIXCTRL_ROTATE_90,   PIXCTRL_FLIP_HORIZONTAL, "rotate90",  },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P,   12,  1280, 720,   0,    PIXCTRL_ROTATE_180,  PIXCTRL_FLIP_HORIZONTAL, "rotate180", },
+    { "yuv", "yuyv422", PIXCTRL_FMT_YUYV422,   16,  1280, 720,   1,    PIXCTRL_ROTATE_0,    PIXCTRL_FLIP_HORIZONTAL, "mirror",    },
+    { "yuv", "yuv444p", PIXCTRL_FMT_YUV444P,   24,  1280, 720,   0,    PIXCTRL_ROTATE_270,  PIXCTRL_FLIP_HORIZONTAL, "rotate270", },
+};
+
+void test_rotate(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_rotate_test_vector) / sizeof(rotate_test_vector_t));
+    int32_t dst_width, dst_height;
+    const rotate_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Rotate and Flip");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_rotate_test_vector[i];
+        if ((vector->is_flip == 0) && ((vector->rotate == PIXCTRL_ROTATE_90) || (vector->rotate == PIXCTRL_ROTATE_270)))
+        {
+            dst_width = vector->height;
+            dst_height = vector->width;
+        }
+        else
+        {
+            dst_width = vector->width;
+            dst_height = vector->height;
+        }
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/rotate/%02d_%s_%s-%dx%d.raw", 
+                                    dirpath, i + 1, vector->op_name, vector->src_fmt,
+                                    dst_width, dst_height);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->bpp) / 8) * (size_t)vector->height));
+
+        dst_len = src_len;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        if (vector->is_flip != 0)
+        {
+            result = pixctrl_generic_flip(vector->fmt, vector->flip, src, vector->width, vector->height, dst);
+        }
+        else
+        {
+            result = pixctrl_generic_rotate(vector->fmt, vector->rotate, src, vector->width, vector->height, dst);
+        }
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to rotate");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    pixctrl_rotate_t rotate;
+    const char *op_name;
+} rotate_convert_test_vector_t;
+
+static const rotate_convert_test_vector_t gsc_rotate_convert_test_vector[] = {
+    /* src   src        pixctrl              src  dst        pixctrl               dst  src          rotate               op
+       group fmt        fmt                  bpp  fmt        fmt                   bpp  width height                      name */
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   PIXCTRL_ROTATE_90,   "rotate90",  },
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   PIXCTRL_ROTATE_270,  "rotate270", },
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,  32,  "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   PIXCTRL_ROTATE_180,  "rotate180", },
+};
+
+void test_rotate_convert(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_rotate_convert_test_vector) / sizeof(rotate_convert_test_vector_t));
+    int32_t dst_width, dst_height;
+    const rotate_convert_test_vector_t *vector;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Rotate and Convert");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_rotate_convert_test_vector[i];
+        if ((vector->rotate == PIXCTRL_ROTATE_90) || (vector->rotate == PIXCTRL_ROTATE_270))
+        {
+            dst_width = vector->height;
+            dst_height = vector->width;
+        }
+        else
+        {
+            dst_width = vector->width;
+            dst_height = vector->height;
+        }
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/rotate/%02d_%s_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->op_name, vector->dst_fmt_name,
+                                    dst_width, dst_height, vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        dst_len = (((size_t)dst_width * vector->dst_bpp) / 8) * (size_t)dst_height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        get_timestamp(&start);
+        result = pixctrl_generic_rotate_convert(vector->fmt, vector->rotate, src, vector->width, vector->height,
+                                                vector->dst_fmt, dst);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            save_data_as_file(result_path, dst, dst_len);
+        }
+        else
+        {
+            puts("failed to rotate and convert");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
+    }
+}
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "util.h"
+#include "pixctrl.h"
+#include "test_vector.h"
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    pixctrl_fmt_t fmt;
+    size_t src_bpp;
+
+    const char *dst_fmt_name;
+    pixctrl_fmt_t dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    int32_t zones_x;
+    int32_t zones_y;
+} luma_stats_test_vector_t;
+
+static const luma_stats_test_vector_t gsc_luma_stats_test_vector[] = {
+    /* src   src        pixctrl              src  dst        pixctrl               dst  src          zones
+       group fmt        fmt                  bpp  fmt        fmt                   bpp  width height x   y */
+    { "rgb", "bgra",    PIXCTRL_FMT_BGRA32,  32,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   8,  6, },
+    { "rgb", "rgb24",   PIXCTRL_FMT_RGB24,   24,  "nv21",    PIXCTRL_FMT_NV21,     12,  1280, 720,   4,  3, },
+    { "rgb", "rgba",    PIXCTRL_FMT_RGBA32,  32,  "yuv420p", PIXCTRL_FMT_YUV420P,  12,  1280, 720,   16, 9, },
+    { "yuv", "yuyv422", PIXCTRL_FMT_YUYV422, 16,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   8,  6, },
+    { "yuv", "yuv420p", PIXCTRL_FMT_YUV420P, 12,  "nv12",    PIXCTRL_FMT_NV12,     12,  1280, 720,   8,  6, },
+};
+
+void test_luma_stats(char *dirpath)
+{
+    int32_t i, test_vectors = (int32_t)(sizeof(gsc_luma_stats_test_vector) / sizeof(luma_stats_test_vector_t));
+    const luma_stats_test_vector_t *vector;
+    pixctrl_luma_stats_t stats;
+    pixctrl_result_t result;
+
+    char resource_path[MAX_PATH_LEN];
+    size_t src_len;
+    uint8_t *src;
+    char *src_filename;
+
+    char result_path[MAX_PATH_LEN];
+    char histogram_path[MAX_PATH_LEN];
+    char *result_path_dir;
+    uint8_t *dst;
+    char *dst_filename;
+    size_t dst_len;
+
+    test_timestamp_t start, end, elapsed;
+
+    puts("###########################################################");
+    puts("                TEST Convert with Luma Statistics");
+    puts("###########################################################");
+
+    for (i = 0; i < test_vectors; ++i)
+    {
+        vector = &gsc_luma_stats_test_vector[i];
+
+        (void)sprintf(resource_path, "%s/resource/%s/%s-%dx%d.raw", 
+                                     dirpath, vector->src_group, vector->src_fmt,
+                                     vector->width, vector->height);
+        (void)sprintf(result_path, "%s/result/stats/%02d_cvt_%s-%dx%d_from_%s.raw", 
+                                    dirpath, i + 1, vector->dst_fmt_name,
+                                    vector->width, vector->height, vector->src_fmt);
+        (void)sprintf(histogram_path, "%s/result/stats/%02d_histogram_u32x256_from_%s.raw", 
+                                       dirpath, i + 1, vector->src_fmt);
+        src_filename = get_filename(resource_path);
+        dst_filename = get_filename(result_path);
+
+        printf("[%2d / %2d] %-24s to %-40s ... ", i + 1, test_vectors, src_filename, dst_filename);
+        fflush(stdout);
+        free(src_filename);
+        free(dst_filename);
+
+        result_path_dir = get_dirpath(result_path);
+        create_directory(result_path_dir);
+        free(result_path_dir);
+
+        src = load_rawdata(resource_path, &src_len);
+        assert(src != NULL);
+        assert(src_len == ((((size_t)vector->width * vector->src_bpp) / 8) * (size_t)vector->height));
+
+        dst_len = (((size_t)vector->width * vector->dst_bpp) / 8) * (size_t)vector->height;
+        dst = (uint8_t *)malloc(dst_len);
+        assert(dst != NULL);
+
+        result = pixctrl_luma_stats_init(&stats, vector->width, vector->height, vector->zones_x, vector->zones_y);
+        assert(result == PIXCTRL_SUCCESS);
+
+        get_timestamp(&start);
+        result = pixctrl_generic_convert_with_luma_stats(vector->fmt, src, vector->width, vector->height,
+                                                         vector->dst_fmt, dst, &stats);
+        get_timestamp(&end);
+
+        if (result == PIXCTRL_SUCCESS)
+        {
+            (void)pixctrl_luma_stats_finish(&stats);
+            save_data_as_file(result_path, dst, dst_len);
+            save_data_as_file(histogram_path, (uint8_t *)stats.histogram, sizeof(stats.histogram));
+        }
+        else
+        {
+            puts("failed to convert");
+        }
+
+        free(src);
+        free(dst);
+
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec] (min %u, max %u, mean %u)\n", elapsed.sec, elapsed.nsec,
+                                                             stats.min, stats.max, stats.mean);
+    }
+}
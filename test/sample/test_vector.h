@@ -1,8 +1,48 @@
 #ifndef __TEST_VECTOR__H__
 #define __TEST_VECTOR__H__
 
+typedef pixctrl_result_t(*convert_vector_entry_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
+
+typedef struct {
+    const char *src_group;
+    const char *src_fmt;
+    size_t src_bpp;
+
+    const char *dst_group;
+    const char *dst_fmt;
+    size_t dst_bpp;
+
+    int32_t width;
+    int32_t height;
+
+    convert_vector_entry_t entry;
+} convert_test_vector_t;
+
+/* the conversion tables are shared with the benchmark */
+extern const convert_test_vector_t *get_rgb2rgb_test_vector(int32_t *test_vectors);
+extern const convert_test_vector_t *get_rgb2yuv_test_vector(int32_t *test_vectors);
+extern const convert_test_vector_t *get_yuv2yuv_test_vector(int32_t *test_vectors);
+
 extern void test_rgb2rgb_convert(char *dirpath);
 extern void test_rgb2yuv_convert(char *dirpath);
+extern void test_rgb2yuv_odd_convert(char *dirpath);
+extern void test_dirty_rect_convert(char *dirpath);
+extern void test_change_detect_convert(char *dirpath);
+extern void test_roi_convert(char *dirpath);
+extern void test_rgb2gray_convert(char *dirpath);
 extern void test_yuv2yuv_convert(char *dirpath);
+extern void test_yuv2gray_convert(char *dirpath);
+extern void test_yuv2rgb_convert(char *dirpath);
+extern void test_detile_convert(char *dirpath);
+extern void test_rgb_alpha_mix(char *dirpath);
+extern void test_rgb_onto_yuv_mix(char *dirpath);
+extern void test_resize(char *dirpath);
+extern void test_resize_convert(char *dirpath);
+extern void test_rotate(char *dirpath);
+extern void test_rotate_convert(char *dirpath);
+extern void test_demosaic(char *dirpath);
+extern void test_isp(char *dirpath);
+extern void test_luma_stats(char *dirpath);
+extern void test_motion(char *dirpath);
 
 #endif  //!__TEST_VECTOR__H__
\ No newline at end of file
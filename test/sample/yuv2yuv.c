@@ -7,22 +7,7 @@
 #include "pixctrl.h"
 #include "test_vector.h"
 
-typedef pixctrl_result_t(*yuv2yuv_vector_entry_t)(uint8_t *src, uint8_t *dst, int32_t width, int32_t height);
-
-typedef struct {
-    const char *src_group;
-    const char *src_fmt;
-    size_t src_bpp;
-
-    const char *dst_group;
-    const char *dst_fmt;
-    size_t dst_bpp;
-
-    int32_t width;
-    int32_t height;
-
-    yuv2yuv_vector_entry_t entry;
-} yuv2yuv_test_vector_t;
+typedef convert_test_vector_t yuv2yuv_test_vector_t;
 
 static const yuv2yuv_test_vector_t gsc_yuv2yuv_test_vector[] = {
     /* src   src        src  dst        dst         dst
@@ -62,6 +47,9 @@ static const yuv2yuv_test_vector_t gsc_yuv2yuv_test_vector[] = {
     { "yuv", "nv21",    12,  "yuv2yuv", "uyvy422",   16, 1280, 720,   pixctrl_generic_nv21_to_uyvy422,     },
     { "yuv", "nv21",    12,  "yuv2yuv", "vyuy422",   16, 1280, 720,   pixctrl_generic_nv21_to_vyuy422,     },
 
+    { "yuv", "nv12",    12,  "yuv2yuv", "nv21",      12, 1280, 720,   pixctrl_generic_nv12_to_nv21,        },
+    { "yuv", "nv21",    12,  "yuv2yuv", "nv12",      12, 1280, 720,   pixctrl_generic_nv21_to_nv12,        },
+
     { "yuv", "yuv444",  24,  "yuv2yuv", "yuv444p",   24, 1280, 720,   pixctrl_generic_yuv444_to_yuv444p,   },
     { "yuv", "yuv444",  24,  "yuv2yuv", "yuv422p",   16, 1280, 720,   pixctrl_generic_yuv444_to_yuv422p,   },
     { "yuv", "yuv444",  24,  "yuv2yuv", "yuv420p",   12, 1280, 720,   pixctrl_generic_yuv444_to_yuv420p,   },
@@ -84,11 +72,11 @@ static const yuv2yuv_test_vector_t gsc_yuv2yuv_test_vector[] = {
     { "yuv", "nv12",    12,  "yuv2yuv", "yuv444p",   24, 1280, 720,   pixctrl_generic_nv12_to_yuv444p,     },
     { "yuv", "nv21",    12,  "yuv2yuv", "yuv444p",   24, 1280, 720,   pixctrl_generic_nv21_to_yuv444p,     },
 
-    { "yuv", "nv12",    12,  "yuv2yuv", "yuv422p",   24, 1280, 720,   pixctrl_generic_nv12_to_yuv422p,     },
-    { "yuv", "nv21",    12,  "yuv2yuv", "yuv422p",   24, 1280, 720,   pixctrl_generic_nv21_to_yuv422p,     },
+    { "yuv", "nv12",    12,  "yuv2yuv", "yuv422p",   16, 1280, 720,   pixctrl_generic_nv12_to_yuv422p,     },
+    { "yuv", "nv21",    12,  "yuv2yuv", "yuv422p",   16, 1280, 720,   pixctrl_generic_nv21_to_yuv422p,     },
 
-    { "yuv", "nv12",    12,  "yuv2yuv", "yuv420p",   24, 1280, 720,   pixctrl_generic_nv12_to_yuv420p,     },
-    { "yuv", "nv21",    12,  "yuv2yuv", "yuv420p",   24, 1280, 720,   pixctrl_generic_nv21_to_yuv420p,     },
+    { "yuv", "nv12",    12,  "yuv2yuv", "yuv420p",   12, 1280, 720,   pixctrl_generic_nv12_to_yuv420p,     },
+    { "yuv", "nv21",    12,  "yuv2yuv", "yuv420p",   12, 1280, 720,   pixctrl_generic_nv21_to_yuv420p,     },
 
     { "yuv", "yuv444p", 24,  "yuv2yuv", "yuv444",    24, 1280, 720,   pixctrl_generic_yuv444p_to_yuv444,   },
 
@@ -130,6 +118,13 @@ static const yuv2yuv_test_vector_t gsc_yuv2yuv_test_vector[] = {
     { "yuv", "yuv420p", 12,  "yuv2yuv", "yuv422p",   16, 1280, 720,   pixctrl_generic_yuv420p_to_yuv422p,  },
 };
 
+const convert_test_vector_t *get_yuv2yuv_test_vector(int32_t *test_vectors)
+{
+    *test_vectors = (int32_t)(sizeof(gsc_yuv2yuv_test_vector) / sizeof(yuv2yuv_test_vector_t));
+
+    return gsc_yuv2yuv_test_vector;
+}
+
 void test_yuv2yuv_convert(char *dirpath)
 {
     int32_t i, test_vectors = (int32_t)(sizeof(gsc_yuv2yuv_test_vector) / sizeof(yuv2yuv_test_vector_t));
@@ -146,7 +141,7 @@ void test_yuv2yuv_convert(char *dirpath)
     char *dst_filename;
     size_t dst_len;
 
-    test_timestamp_t start, end;
+    test_timestamp_t start, end, elapsed;
 
     puts("###########################################################");
     puts("                TEST YUV to YUV Convert");
@@ -199,6 +194,7 @@ void test_yuv2yuv_convert(char *dirpath)
         free(src);
         free(dst);
 
-        printf("%zu.%09zu [sec]\n", end.sec - start.sec, end.nsec - start.nsec);
+        get_elapsed_time(&start, &end, &elapsed);
+        printf("%zu.%09zu [sec]\n", elapsed.sec, elapsed.nsec);
     }
 }
@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include <unistd.h>
+#include <getopt.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "util.h"
+#include "pixctrl.h"
+#include "stripe.h"
+
+#define DEFAULT_WIDTH           (1920)
+#define DEFAULT_CALLS           (1000)
+#define DEFAULT_SAMPLES         (31)
+#define STRIPE_ALIGNMENT        (64)
+#define CALIBRATION_NSEC        (100000000U)    /* 100 ms against the monotonic clock */
+
+typedef struct {
+    const char *name;
+    const stripe_kernel_t *(*get_kernels)(int32_t *kernels);
+} stripe_table_t;
+
+typedef struct {
+    const char *filter;
+    int32_t width;
+    int32_t calls;
+    int32_t samples;
+    double ghz;                 /* core clock to turn ticks into cycles, 0 when unknown */
+} stripe_option_t;
+
+static const stripe_table_t gsc_stripe_table[] = {
+    { "generic", get_generic_stripe_kernels, },
+};
+
+static void print_usage(const char *prog)
+{
+    printf("usage: %s [-f filter] [-w width] [-n calls] [-r samples] [-g GHz]\n", prog);
+    puts("  -f  run only kernels whose name (e.g. 'generic/xrgb_to_yuv420') contains 'filter'");
+    printf("  -w  pixels per row, even (default %d), keep the rows within L1 to time the kernel alone\n", DEFAULT_WIDTH);
+    printf("  -n  calls on the same row per sample (default %d)\n", DEFAULT_CALLS);
+    printf("  -r  timed samples (default %d)\n", DEFAULT_SAMPLES);
+    puts("  -g  core clock in GHz, adds cycles per pixel derived from the tick rate");
+}
+
+static int32_t parse_option(int32_t argc, char *argv[], stripe_option_t *option)
+{
+    int32_t ret = 0;
+    int opt;
+
+    option->filter = NULL;
+    option->width = DEFAULT_WIDTH;
+    option->calls = DEFAULT_CALLS;
+    option->samples = DEFAULT_SAMPLES;
+    option->ghz = 0.0;
+
+    while ((ret == 0) && ((opt = getopt(argc, argv, "f:w:n:r:g:h")) != -1))
+    {
+        switch (opt) {
+        case 'f':
+            option->filter = optarg;
+            break;
+        case 'w':
+            option->width = atoi(optarg);
+            ret = ((option->width > 0) && ((option->width % 2) == 0)) ? 0 : -1;
+            break;
+        case 'n':
+            option->calls = atoi(optarg);
+            ret = (option->calls > 0) ? 0 : -1;
+            break;
+        case 'r':
+            option->samples = atoi(optarg);
+            ret = (option->samples > 0) ? 0 : -1;
+            break;
+        case 'g':
+            option->ghz = atof(optarg);
+            ret = (option->ghz > 0.0) ? 0 : -1;
+            break;
+        default:
+            ret = -1;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/* time stamp counter on x86, virtual counter on aarch64, nanoseconds elsewhere */
+static inline uint64_t read_tick(void)
+{
+    uint64_t tick;
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();               /* earlier calls retire before the counter is read */
+    tick = __rdtsc();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(tick) : : "memory");
+#else
+    test_timestamp_t now;
+
+    get_timestamp(&now);
+    tick = ((uint64_t)now.sec * 1000000000U) + (uint64_t)now.nsec;
+#endif
+
+    return tick;
+}
+
+static const char *get_tick_source(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "rdtsc";
+#elif defined(__aarch64__)
+    return "cntvct_el0";
+#else
+    return "clock_gettime";
+#endif
+}
+
+/* ticks per nanosecond, the tsc runs at the nominal clock and cntvct at the timer frequency */
+static double calibrate_tick(void)
+{
+    test_timestamp_t start, now;
+    uint64_t begin, end;
+    size_t nsec;
+
+    get_timestamp(&start);
+    begin = read_tick();
+    do
+    {
+        get_timestamp(&now);
+        nsec = get_elapsed_nsec(&start, &now);
+    } while (nsec < CALIBRATION_NSEC);
+    end = read_tick();
+
+    return (double)(end - begin) / (double)nsec;
+}
+
+static int compare_samples(const void *lhs, const void *rhs)
+{
+    double l = *(const double *)lhs, r = *(const double *)rhs;
+
+    return (l > r) - (l < r);
+}
+
+static uint8_t *create_plane(size_t len)
+{
+    void *buf = NULL;
+    size_t i;
+
+    if (posix_memalign(&buf, STRIPE_ALIGNMENT, len) != 0)
+    {
+        buf = NULL;
+    }
+    assert(buf != NULL);
+
+    /* hashed bytes, so neither flat nor saturated data takes a shortcut */
+    for (i = 0; i < len; ++i)
+    {
+        ((uint8_t *)buf)[i] = (uint8_t)((i * 2654435761U) >> 24);
+    }
+
+    return (uint8_t *)buf;
+}
+
+/* 'samples' gets ticks per pixel of every sample, sorted */
+static void measure_kernel(const stripe_kernel_t *kernel, const stripe_row_t *row,
+                           const stripe_option_t *option, double *samples)
+{
+    uint64_t begin, end;
+    int32_t i, call;
+
+    /* the untimed pass pulls the rows into L1 and settles the branch predictors */
+    for (call = 0; call < option->calls; ++call)
+    {
+        kernel->run(row);
+    }
+
+    for (i = 0; i < option->samples; ++i)
+    {
+        begin = read_tick();
+        for (call = 0; call < option->calls; ++call)
+        {
+            kernel->run(row);
+        }
+        end = read_tick();
+        samples[i] = (double)(end - begin) / ((double)option->calls * (double)row->width);
+    }
+
+    qsort(samples, (size_t)option->samples, sizeof(double), compare_samples);
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0;
+    char name[MAX_FILENAME];
+    stripe_option_t option;
+    stripe_row_t row;
+    pixctrl_luma_stats_t stats;
+    const stripe_kernel_t *kernels;
+    double *samples;
+    double tick_per_nsec, median;
+    uint64_t sink = 0U;
+    size_t len;
+    int32_t t, i, plane, stripe_kernels;
+
+    if (parse_option(argc, argv, &option) == 0)
+    {
+        len = STRIPE_PLANE_LEN(option.width);
+        for (plane = 0; plane < 3; ++plane)
+        {
+            row.src[plane] = create_plane(len);
+            row.dst[plane] = create_plane(len);
+        }
+        row.src16 = (uint16_t *)(void *)row.src[0];
+        row.dst16 = (uint16_t *)(void *)row.dst[0];
+        row.dst32 = (uint32_t *)(void *)row.dst[0];
+        row.sink = &sink;
+        row.stats = &stats;
+        row.width = option.width;
+        (void)pixctrl_luma_stats_init(&stats, option.width, 2, (option.width < 4) ? 1 : 4, 1);
+
+        samples = (double *)malloc(sizeof(double) * (size_t)option.samples);
+        assert(samples != NULL);
+
+        tick_per_nsec = calibrate_tick();
+        printf("tick source %s, %.3f ticks/ns, width %d, %d calls x %d samples\n",
+               get_tick_source(), tick_per_nsec, option.width, option.calls, option.samples);
+        printf("%-36s %12s %12s %8s", "kernel", "min[tick/px]", "med[tick/px]", "ns/px");
+        if (option.ghz > 0.0)
+        {
+            printf(" %8s", "cyc/px");
+        }
+        putchar('\n');
+
+        for (t = 0; t < (int32_t)(sizeof(gsc_stripe_table) / sizeof(stripe_table_t)); ++t)
+        {
+            kernels = gsc_stripe_table[t].get_kernels(&stripe_kernels);
+            for (i = 0; i < stripe_kernels; ++i)
+            {
+                (void)snprintf(name, sizeof(name), "%s/%s", gsc_stripe_table[t].name, kernels[i].name);
+                if ((option.filter != NULL) && (strstr(name, option.filter) == NULL))
+                {
+                    continue;
+                }
+
+                measure_kernel(&kernels[i], &row, &option, samples);
+                median = samples[option.samples / 2];
+                printf("%-36s %12.3f %12.3f %8.3f", name, samples[0], median, median / tick_per_nsec);
+                if (option.ghz > 0.0)
+                {
+                    printf(" %8.3f", (median / tick_per_nsec) * option.ghz);
+                }
+                putchar('\n');
+            }
+        }
+
+        free(samples);
+        for (plane = 0; plane < 3; ++plane)
+        {
+            free(row.src[plane]);
+            free(row.dst[plane]);
+        }
+    }
+    else
+    {
+        print_usage(argv[0]);
+        ret = -1;
+    }
+
+    return ret;
+}
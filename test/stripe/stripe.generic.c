@@ -0,0 +1,488 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "pixctrl.h"
+#include "stripe.h"
+
+#define STRIPE_RAW_BITS         (10)
+
+static const pixctrl_rgb_order_t gsc_order_rgba = INIT_PIXCTRL_ORDER_RGBA;
+static const pixctrl_rgb_order_t gsc_order_argb = INIT_PIXCTRL_ORDER_ARGB;
+static const pixctrl_rgb_order_t gsc_order_rgb = INIT_PIXCTRL_ORDER_RGB;
+static const pixctrl_yuv_order_t gsc_order_yuv444 = INIT_PIXCTRL_ORDER_YUV444;
+static const pixctrl_yuv_order_t gsc_order_yuyv422 = INIT_PIXCTRL_ORDER_YUYV422;
+static const pixctrl_yuv_order_t gsc_order_nv12 = INIT_PIXCTRL_ORDER_NV12;
+static const pixctrl_tile_t gsc_tile = INIT_PIXCTRL_TILE_16X16;
+
+/* unity gains and matrix, linear shift instead of a gamma table */
+static const pixctrl_isp_t gsc_isp = {
+    { 1 << PIXCTRL_ISP_Q, 1 << PIXCTRL_ISP_Q, 1 << PIXCTRL_ISP_Q, },
+    { 1 << PIXCTRL_ISP_Q, 0, 0, 0, 1 << PIXCTRL_ISP_Q, 0, 0, 0, 1 << PIXCTRL_ISP_Q, },
+    NULL,
+};
+
+/********************************************************************************************
+ *  RGB to RGB Converter
+ ********************************************************************************************
+ */
+static void run_xrgb_to_rgb24(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_rgb24_line_stripe(row->src[0], &gsc_order_rgba, row->dst[0], &gsc_order_rgb, row->width);
+}
+
+static void run_xrgb32_to_argb32(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb32_to_argb32_line_stripe(row->src[0], &gsc_order_rgba,
+                                                 row->dst[0], &gsc_order_argb, row->width);
+}
+
+/********************************************************************************************
+ *  RGB to YUV Converter
+ ********************************************************************************************
+ */
+static void run_xrgb_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv444_line_stripe(row->src[0], &gsc_order_rgba,
+                                               row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_xrgb_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv422_line_stripe(row->src[0], &gsc_order_rgba,
+                                               row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_xrgb_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv420_line_stripe(row->src[0], &gsc_order_rgba,
+                                               row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_xrgb_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv444p_line_stripe(row->src[0], &gsc_order_rgba,
+                                                row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_xrgb_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv422p_line_stripe(row->src[0], &gsc_order_rgba,
+                                                row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_xrgb_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_yuv420p_line_stripe(row->src[0], &gsc_order_rgba,
+                                                row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_hash(const stripe_row_t *row)
+{
+    *row->sink = pixctrl_generic_hash_line_stripe(row->src[0], (size_t)row->width, *row->sink);
+}
+
+/********************************************************************************************
+ *  RGB to GRAY Converter
+ ********************************************************************************************
+ */
+static void run_xrgb_to_gray8(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb_to_gray8_line_stripe(row->src[0], &gsc_order_rgba, row->dst[0], row->width);
+}
+
+/********************************************************************************************
+ *  YUV to YUV Converter
+ ********************************************************************************************
+ */
+static void run_yuv444_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_yuv422_line_stripe(row->src[0], &gsc_order_yuv444,
+                                                 row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_yuv444_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_yuv420_line_stripe(row->src[0], &gsc_order_yuv444,
+                                                 row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv422_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_yuv444_line_stripe(row->src[0], &gsc_order_yuyv422,
+                                                 row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_yuv422_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_yuv420_line_stripe(row->src[0], &gsc_order_yuyv422,
+                                                 row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv420_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv444_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                 row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_yuv420_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv422_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                 row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_yuv420_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv420_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                 row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv444_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_yuv444p_line_stripe(row->src[0], &gsc_order_yuv444,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv444_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_yuv422p_line_stripe(row->src[0], &gsc_order_yuv444,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv444_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_yuv420p_line_stripe(row->src[0], &gsc_order_yuv444,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_yuv422_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_yuv444p_line_stripe(row->src[0], &gsc_order_yuyv422,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv422_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_yuv422p_line_stripe(row->src[0], &gsc_order_yuyv422,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv422_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_yuv420p_line_stripe(row->src[0], &gsc_order_yuyv422,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_yuv420_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv444p_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv420_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv422p_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv420_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_yuv420p_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                                  row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_yuv444p_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444p_to_yuv444_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_yuv444p_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444p_to_yuv422_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_yuv444p_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444p_to_yuv420_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv422p_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422p_to_yuv444_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_yuv422p_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422p_to_yuv422_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_yuv422p_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422p_to_yuv420_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv420p_to_yuv444(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_yuv444_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuv444, row->width);
+}
+
+static void run_yuv420p_to_yuv422(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_yuv422_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], &gsc_order_yuyv422, row->width);
+}
+
+static void run_yuv420p_to_yuv420(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_yuv420_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                  row->dst[0], row->dst[1], &gsc_order_nv12, row->width, 0);
+}
+
+static void run_yuv444p_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444p_to_yuv422p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv444p_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444p_to_yuv420p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_yuv422p_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422p_to_yuv444p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv422p_to_yuv420p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422p_to_yuv420p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width, 0);
+}
+
+static void run_yuv420p_to_yuv444p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_yuv444p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+static void run_yuv420p_to_yuv422p(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_yuv422p_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                   row->dst[0], row->dst[1], row->dst[2], row->width);
+}
+
+/********************************************************************************************
+ *  YUV to GRAY Converter
+ ********************************************************************************************
+ */
+static void run_yuv444_to_gray8(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv444_to_gray8_line_stripe(row->src[0], &gsc_order_yuv444, row->dst[0], row->width);
+}
+
+static void run_yuv422_to_gray8(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv422_to_gray8_line_stripe(row->src[0], &gsc_order_yuyv422, row->dst[0], row->width);
+}
+
+/********************************************************************************************
+ *  YUV to RGB Converter
+ ********************************************************************************************
+ */
+static void run_yuv420_to_xrgb(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420_to_xrgb_line_stripe(row->src[0], row->src[1], &gsc_order_nv12,
+                                               row->dst[0], &gsc_order_rgba, row->width);
+}
+
+static void run_yuv420p_to_xrgb(const stripe_row_t *row)
+{
+    pixctrl_generic_yuv420p_to_xrgb_line_stripe(row->src[0], row->src[1], row->src[2],
+                                                row->dst[0], &gsc_order_rgba, row->width);
+}
+
+/********************************************************************************************
+ *  Tiled YUV Converter
+ ********************************************************************************************
+ */
+static void run_detile(const stripe_row_t *row)
+{
+    pixctrl_generic_detile_line_stripe(row->src[0], &gsc_tile, 0, row->dst[0], row->width);
+}
+
+static void run_tile(const stripe_row_t *row)
+{
+    pixctrl_generic_tile_line_stripe(row->src[0], row->width, row->dst[0], &gsc_tile, 0);
+}
+
+/********************************************************************************************
+ *  RGB to RGB Mixer
+ ********************************************************************************************
+ */
+static void run_xrgb32_premultiply(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb32_premultiply_line_stripe(row->src[0], row->dst[0], &gsc_order_rgba, row->width);
+}
+
+static void run_xrgb32_unpremultiply(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb32_unpremultiply_line_stripe(row->src[0], row->dst[0], &gsc_order_rgba, row->width);
+}
+
+/********************************************************************************************
+ *  RGB to YUV Mixer
+ ********************************************************************************************
+ */
+static void run_xrgb32_blend_to_y(const stripe_row_t *row)
+{
+    pixctrl_generic_xrgb32_blend_to_y_line_stripe(row->src[0], &gsc_order_rgba, PIXCTRL_ALPHA_STRAIGHT,
+                                                  row->dst[0], row->width);
+}
+
+static void run_xrgb32_blend_to_uv(const stripe_row_t *row)
+{
+    /* nv12 chroma, 'U' and 'V' interleaved */
+    pixctrl_generic_xrgb32_blend_to_uv_line_stripe(row->src[0], row->src[1], &gsc_order_rgba,
+                                                   PIXCTRL_ALPHA_STRAIGHT, 0, row->width,
+                                                   row->dst[0], row->dst[0] + 1, 2);
+}
+
+/********************************************************************************************
+ *  Raw and Demosaic
+ ********************************************************************************************
+ */
+static void run_raw8_unpack(const stripe_row_t *row)
+{
+    pixctrl_generic_raw8_unpack_line_stripe(row->src[0], row->dst16, row->width);
+}
+
+static void run_raw16_unpack(const stripe_row_t *row)
+{
+    pixctrl_generic_raw16_unpack_line_stripe(row->src[0], row->dst16, row->width, STRIPE_RAW_BITS);
+}
+
+static void run_raw10_mipi_unpack(const stripe_row_t *row)
+{
+    pixctrl_generic_raw10_mipi_unpack_line_stripe(row->src[0], row->dst16, row->width);
+}
+
+static void run_raw16_pack(const stripe_row_t *row)
+{
+    pixctrl_generic_raw16_pack_line_stripe(row->src16, row->dst[0], row->width);
+}
+
+/********************************************************************************************
+ *  ISP
+ ********************************************************************************************
+ */
+static void run_rgb48_to_xrgb(const stripe_row_t *row)
+{
+    pixctrl_generic_rgb48_to_xrgb_line_stripe(row->src16, STRIPE_RAW_BITS, row->dst[0], &gsc_order_rgba, row->width);
+}
+
+static void run_rgb48_isp(const stripe_row_t *row)
+{
+    pixctrl_generic_rgb48_isp_line_stripe(row->src16, STRIPE_RAW_BITS, &gsc_isp,
+                                          row->dst[0], &gsc_order_rgba, row->width);
+}
+
+/********************************************************************************************
+ *  Luma Statistics
+ ********************************************************************************************
+ */
+static void run_luma_stats(const stripe_row_t *row)
+{
+    pixctrl_generic_luma_stats_line_stripe(row->src[0], 0, row->stats);
+}
+
+/********************************************************************************************
+ *  Motion
+ ********************************************************************************************
+ */
+static void run_absdiff(const stripe_row_t *row)
+{
+    pixctrl_generic_absdiff_line_stripe(row->src[0], row->src[1], row->dst[0], row->width);
+}
+
+static void run_sad(const stripe_row_t *row)
+{
+    pixctrl_generic_sad_line_stripe(row->src[0], row->src[1], row->dst32, row->width);
+}
+
+static const stripe_kernel_t gsc_generic_stripe_kernel[] = {
+    { "xrgb_to_rgb24", run_xrgb_to_rgb24, },
+    { "xrgb32_to_argb32", run_xrgb32_to_argb32, },
+    { "xrgb_to_yuv444", run_xrgb_to_yuv444, },
+    { "xrgb_to_yuv422", run_xrgb_to_yuv422, },
+    { "xrgb_to_yuv420", run_xrgb_to_yuv420, },
+    { "xrgb_to_yuv444p", run_xrgb_to_yuv444p, },
+    { "xrgb_to_yuv422p", run_xrgb_to_yuv422p, },
+    { "xrgb_to_yuv420p", run_xrgb_to_yuv420p, },
+    { "hash", run_hash, },
+    { "xrgb_to_gray8", run_xrgb_to_gray8, },
+    { "yuv444_to_yuv422", run_yuv444_to_yuv422, },
+    { "yuv444_to_yuv420", run_yuv444_to_yuv420, },
+    { "yuv422_to_yuv444", run_yuv422_to_yuv444, },
+    { "yuv422_to_yuv420", run_yuv422_to_yuv420, },
+    { "yuv420_to_yuv444", run_yuv420_to_yuv444, },
+    { "yuv420_to_yuv422", run_yuv420_to_yuv422, },
+    { "yuv420_to_yuv420", run_yuv420_to_yuv420, },
+    { "yuv444_to_yuv444p", run_yuv444_to_yuv444p, },
+    { "yuv444_to_yuv422p", run_yuv444_to_yuv422p, },
+    { "yuv444_to_yuv420p", run_yuv444_to_yuv420p, },
+    { "yuv422_to_yuv444p", run_yuv422_to_yuv444p, },
+    { "yuv422_to_yuv422p", run_yuv422_to_yuv422p, },
+    { "yuv422_to_yuv420p", run_yuv422_to_yuv420p, },
+    { "yuv420_to_yuv444p", run_yuv420_to_yuv444p, },
+    { "yuv420_to_yuv422p", run_yuv420_to_yuv422p, },
+    { "yuv420_to_yuv420p", run_yuv420_to_yuv420p, },
+    { "yuv444p_to_yuv444", run_yuv444p_to_yuv444, },
+    { "yuv444p_to_yuv422", run_yuv444p_to_yuv422, },
+    { "yuv444p_to_yuv420", run_yuv444p_to_yuv420, },
+    { "yuv422p_to_yuv444", run_yuv422p_to_yuv444, },
+    { "yuv422p_to_yuv422", run_yuv422p_to_yuv422, },
+    { "yuv422p_to_yuv420", run_yuv422p_to_yuv420, },
+    { "yuv420p_to_yuv444", run_yuv420p_to_yuv444, },
+    { "yuv420p_to_yuv422", run_yuv420p_to_yuv422, },
+    { "yuv420p_to_yuv420", run_yuv420p_to_yuv420, },
+    { "yuv444p_to_yuv422p", run_yuv444p_to_yuv422p, },
+    { "yuv444p_to_yuv420p", run_yuv444p_to_yuv420p, },
+    { "yuv422p_to_yuv444p", run_yuv422p_to_yuv444p, },
+    { "yuv422p_to_yuv420p", run_yuv422p_to_yuv420p, },
+    { "yuv420p_to_yuv444p", run_yuv420p_to_yuv444p, },
+    { "yuv420p_to_yuv422p", run_yuv420p_to_yuv422p, },
+    { "yuv444_to_gray8", run_yuv444_to_gray8, },
+    { "yuv422_to_gray8", run_yuv422_to_gray8, },
+    { "yuv420_to_xrgb", run_yuv420_to_xrgb, },
+    { "yuv420p_to_xrgb", run_yuv420p_to_xrgb, },
+    { "detile", run_detile, },
+    { "tile", run_tile, },
+    { "xrgb32_premultiply", run_xrgb32_premultiply, },
+    { "xrgb32_unpremultiply", run_xrgb32_unpremultiply, },
+    { "xrgb32_blend_to_y", run_xrgb32_blend_to_y, },
+    { "xrgb32_blend_to_uv", run_xrgb32_blend_to_uv, },
+    { "raw8_unpack", run_raw8_unpack, },
+    { "raw16_unpack", run_raw16_unpack, },
+    { "raw10_mipi_unpack", run_raw10_mipi_unpack, },
+    { "raw16_pack", run_raw16_pack, },
+    { "rgb48_to_xrgb", run_rgb48_to_xrgb, },
+    { "rgb48_isp", run_rgb48_isp, },
+    { "luma_stats", run_luma_stats, },
+    { "absdiff", run_absdiff, },
+    { "sad", run_sad, },
+};
+
+const stripe_kernel_t *get_generic_stripe_kernels(int32_t *kernels)
+{
+    *kernels = (int32_t)(sizeof(gsc_generic_stripe_kernel) / sizeof(stripe_kernel_t));
+
+    return gsc_generic_stripe_kernel;
+}
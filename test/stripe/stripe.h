@@ -0,0 +1,27 @@
+#ifndef __STRIPE__H__
+#define __STRIPE__H__
+
+/* hot buffers of one row, every plane holds at least STRIPE_PLANE_LEN(width) bytes */
+#define STRIPE_PLANE_LEN(width)     ((size_t)(width) * 16U + 4096U)
+
+typedef struct {
+    uint8_t *src[3];            /* packed source or the 'Y', 'U'/'UV', 'V' planes */
+    uint8_t *dst[3];
+    uint16_t *src16;            /* raw and rgb48 rows, same storage as src[0] */
+    uint16_t *dst16;            /* same storage as dst[0] */
+    uint32_t *dst32;            /* block sums, same storage as dst[0] */
+    uint64_t *sink;             /* keeps returned values alive */
+    pixctrl_luma_stats_t *stats;
+    int32_t width;
+} stripe_row_t;
+
+typedef struct {
+    const char *name;
+    void (*run)(const stripe_row_t *row);
+} stripe_kernel_t;
+
+/* exported pixctrl_generic_*_line_stripe functions, each fed row 0 (the one writing chroma),
+ * a SIMD backend adds its own get_*_stripe_kernels() next to this one */
+extern const stripe_kernel_t *get_generic_stripe_kernels(int32_t *kernels);
+
+#endif  //!__STRIPE__H__
@@ -167,3 +167,29 @@ test_result_t save_test_image_as_rawdata(const char *rootpath, const char *prefi
     result = save_data_as_file(destpath, buf, len);
     return result;
 }
+
+void get_elapsed_time(const test_timestamp_t *start, const test_timestamp_t *end, test_timestamp_t *elapsed)
+{
+    assert((start != NULL) && (end != NULL) && (elapsed != NULL));
+
+    /* borrow one second when the nanoseconds field has wrapped */
+    if (end->nsec < start->nsec)
+    {
+        elapsed->sec = end->sec - start->sec - 1U;
+        elapsed->nsec = (end->nsec + 1000000000U) - start->nsec;
+    }
+    else
+    {
+        elapsed->sec = end->sec - start->sec;
+        elapsed->nsec = end->nsec - start->nsec;
+    }
+}
+
+size_t get_elapsed_nsec(const test_timestamp_t *start, const test_timestamp_t *end)
+{
+    test_timestamp_t elapsed;
+
+    get_elapsed_time(start, end, &elapsed);
+
+    return (elapsed.sec * 1000000000U) + elapsed.nsec;
+}
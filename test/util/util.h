@@ -39,6 +39,8 @@ extern test_result_t create_directory(const char *path);
 extern char *get_dirpath(const char *path);
 extern char *get_filename(const char *path);
 extern void get_timestamp(test_timestamp_t *timestamp);
+extern void get_elapsed_time(const test_timestamp_t *start, const test_timestamp_t *end, test_timestamp_t *elapsed);
+extern size_t get_elapsed_nsec(const test_timestamp_t *start, const test_timestamp_t *end);
 
 
 #endif  //!__UTIL__H__
\ No newline at end of file